@@ -20,15 +20,34 @@
  */
 
 #include "dockitemcontroller.h"
+#include "util/hotpathprofiler.h"
+#include "util/startupprofiler.h"
 #include "item/appitem.h"
 #include "item/stretchitem.h"
 #include "item/launcheritem.h"
 #include "item/pluginsitem.h"
 
 #include <QDebug>
+#include <QDBusPendingCall>
+#include <QDBusPendingReply>
+#include <QDBusPendingCallWatcher>
 
 DockItemController *DockItemController::INSTANCE = nullptr;
 
+///
+/// \brief The DockItemController::EntryBatch struct collects the GetAll
+/// replies of entries announced together, so they are inserted in order
+/// once all of them arrived.
+///
+struct DockItemController::EntryBatch
+{
+    int generation;
+    int index;
+    int pending;
+    QList<QDBusObjectPath> paths;
+    QList<QVariantMap> properties;
+};
+
 DockItemController *DockItemController::instance(QObject *parent)
 {
     if (!INSTANCE)
@@ -49,6 +68,8 @@ const QList<PluginsItemInterface *> DockItemController::pluginList() const
 
 bool DockItemController::appIsOnDock(const QString &appDesktop) const
 {
+    PROFILE_HOT_PATH("DBusDock::IsOnDock (blocking)");
+
     return m_appInter->IsOnDock(appDesktop);
 }
 
@@ -106,6 +127,8 @@ void DockItemController::itemMove(DockItem * const moveItem, DockItem * const re
                                 // disable insert after placeholder item
                                 m_itemList.indexOf(replaceItem) - 1 :
                                 m_itemList.indexOf(replaceItem);
+    if (moveIndex == replaceIndex)
+        return;
 
     m_itemList.removeAt(moveIndex);
     m_itemList.insert(replaceIndex, moveItem);
@@ -115,11 +138,104 @@ void DockItemController::itemMove(DockItem * const moveItem, DockItem * const re
     if (moveType == DockItem::Plugins || replaceType == DockItem::Plugins)
         m_updatePluginsOrderTimer->start();
 
+    // dragged items are committed once in finishDragSession
+    if (moveItem == m_dragSessionItem)
+        return;
+
     // for app move, index 0 is launcher item, need to pass it.
     if (moveType == DockItem::App && replaceType == DockItem::App)
         m_appInter->MoveEntry(moveIndex - 1, replaceIndex - 1);
 }
 
+///
+/// \brief DockItemController::beginDragSession remember where the dragged item
+/// started, moves during the drag are only applied locally.
+/// \param item
+///
+void DockItemController::beginDragSession(DockItem * const item)
+{
+    m_dragSessionItem = item;
+    m_dragSessionOrigin = m_itemList.indexOf(item);
+}
+
+///
+/// \brief DockItemController::finishDragSession send one MoveEntry from the
+/// original to the final index, or move the item back if the drag is canceled.
+/// \param commit
+///
+void DockItemController::finishDragSession(const bool commit)
+{
+    if (m_dragSessionItem.isNull())
+        return;
+
+    DockItem *item = m_dragSessionItem;
+    const int origin = m_dragSessionOrigin;
+    const int current = m_itemList.indexOf(item);
+    m_dragSessionItem.clear();
+
+    if (current == -1 || current == origin)
+        return;
+
+    if (!commit)
+    {
+        m_itemList.removeAt(current);
+        m_itemList.insert(origin, item);
+        emit itemMoved(item, origin);
+
+        if (item->itemType() == DockItem::Plugins)
+            m_updatePluginsOrderTimer->start();
+        return;
+    }
+
+    // for app move, index 0 is launcher item, need to pass it.
+    if (item->itemType() == DockItem::App)
+        m_appInter->MoveEntry(origin - 1, current - 1);
+}
+
+///
+/// \brief DockItemController::dragSessionItemInserted the drag origin counts
+/// the items before the dragged one, shift it when another item lands there,
+/// so the final MoveEntry still starts from the daemon's index of the entry.
+/// \param index where the new item now is in m_itemList
+///
+void DockItemController::dragSessionItemInserted(const int index)
+{
+    if (m_dragSessionItem.isNull())
+        return;
+
+    const int current = m_itemList.indexOf(m_dragSessionItem);
+    if (current == -1)
+        return;
+
+    // position among the other items, the dragged one left out
+    const int position = index > current ? index - 1 : index;
+    if (position <= m_dragSessionOrigin)
+        ++m_dragSessionOrigin;
+}
+
+///
+/// \brief DockItemController::dragSessionItemRemoved counterpart of
+/// dragSessionItemInserted, call it before \a item leaves m_itemList. The
+/// session ends if the dragged item itself goes away.
+///
+void DockItemController::dragSessionItemRemoved(DockItem * const item)
+{
+    if (m_dragSessionItem.isNull())
+        return;
+
+    if (item == m_dragSessionItem)
+        return m_dragSessionItem.clear();
+
+    const int current = m_itemList.indexOf(m_dragSessionItem);
+    const int index = m_itemList.indexOf(item);
+    if (current == -1 || index == -1)
+        return;
+
+    const int position = index > current ? index - 1 : index;
+    if (position < m_dragSessionOrigin)
+        --m_dragSessionOrigin;
+}
+
 void DockItemController::itemDroppedIntoContainer(DockItem * const item)
 {
     Q_ASSERT(item->itemType() == DockItem::Plugins);
@@ -135,6 +251,7 @@ void DockItemController::itemDroppedIntoContainer(DockItem * const item)
 
     // remove from main panel
     emit itemRemoved(item);
+    dragSessionItemRemoved(item);
     m_itemList.removeOne(item);
 
     // add to container
@@ -165,12 +282,15 @@ void DockItemController::placeholderItemAdded(PlaceholderItem *item, DockItem *p
     const int pos = m_itemList.indexOf(position);
 
     m_itemList.insert(pos, item);
+    dragSessionItemInserted(pos);
 
     emit itemInserted(pos, item);
 }
 
 void DockItemController::placeholderItemDocked(const QString &appDesktop, DockItem *position)
 {
+    PROFILE_HOT_PATH("DBusDock::RequestDock (blocking)");
+
     m_appInter->RequestDock(appDesktop, m_itemList.indexOf(position) - 1).waitForFinished();
 }
 
@@ -178,6 +298,7 @@ void DockItemController::placeholderItemRemoved(PlaceholderItem *item)
 {
     emit itemRemoved(item);
 
+    dragSessionItemRemoved(item);
     m_itemList.removeOne(item);
 }
 
@@ -186,10 +307,13 @@ DockItemController::DockItemController(QObject *parent)
 
       m_updatePluginsOrderTimer(new QTimer(this)),
 
-      m_appInter(new DBusDock(this)),
+      m_appInter(DBusDock::instance()),
       m_pluginsInter(new DockPluginsController(this)),
       m_placeholderItem(new StretchItem),
-      m_containerItem(new ContainerItem)
+      m_containerItem(new ContainerItem),
+
+      m_entryGeneration(0),
+      m_dragSessionOrigin(-1)
 {
 //    m_placeholderItem->hide();
 
@@ -197,19 +321,16 @@ DockItemController::DockItemController(QObject *parent)
     m_updatePluginsOrderTimer->setInterval(1000);
 
     m_itemList.append(new LauncherItem);
-    for (auto entry : m_appInter->entries())
-    {
-        AppItem *it = new AppItem(entry);
-
-        connect(it, &AppItem::requestActivateWindow, m_appInter, &DBusDock::ActivateWindow, Qt::QueuedConnection);
-        connect(it, &AppItem::requestPreviewWindow, m_appInter, &DBusDock::PreviewWindow);
-        connect(it, &AppItem::requestCancelPreview, m_appInter, &DBusDock::CancelPreviewWindow);
-
-        m_itemList.append(it);
-    }
     m_itemList.append(m_placeholderItem);
     m_itemList.append(m_containerItem);
 
+    // app items are inserted when their properties arrive
+    const QList<QDBusObjectPath> entries = m_appInter->entries();
+    if (entries.isEmpty())
+        markAppsPopulated();
+    else
+        fetchAppItems(entries, -1);
+
     connect(m_updatePluginsOrderTimer, &QTimer::timeout, this, &DockItemController::updatePluginsItemOrderKey);
 
     connect(m_appInter, &DBusDock::EntryAdded, this, &DockItemController::appItemAdded);
@@ -224,27 +345,35 @@ DockItemController::DockItemController(QObject *parent)
 }
 
 void DockItemController::appItemAdded(const QDBusObjectPath &path, const int index)
+{
+    fetchAppItems(QList<QDBusObjectPath>() << path, index);
+}
+
+void DockItemController::insertAppItem(const QDBusObjectPath &path, const int index, const QVariantMap &properties)
 {
     // the first index is launcher item
     int insertIndex = 1;
 
-    // -1 for append to app list end
+    int appCount = 0;
+    for (auto item : m_itemList)
+        if (item->itemType() == DockItem::App)
+            ++appCount;
+
+    // -1 for append to app list end, other fetches may still be in flight
+    // so the daemon index can be ahead of our list
     if (index != -1)
-    {
-        insertIndex += index;
-    } else {
-        for (auto item : m_itemList)
-            if (item->itemType() == DockItem::App)
-                ++insertIndex;
-    }
+        insertIndex += qMin(index, appCount);
+    else
+        insertIndex += appCount;
 
-    AppItem *item = new AppItem(path);
+    AppItem *item = new AppItem(path, properties);
 
     connect(item, &AppItem::requestActivateWindow, m_appInter, &DBusDock::ActivateWindow, Qt::QueuedConnection);
     connect(item, &AppItem::requestPreviewWindow, m_appInter, &DBusDock::PreviewWindow);
     connect(item, &AppItem::requestCancelPreview, m_appInter, &DBusDock::CancelPreviewWindow);
 
     m_itemList.insert(insertIndex, item);
+    dragSessionItemInserted(insertIndex);
     emit itemInserted(insertIndex, item);
 }
 
@@ -268,12 +397,15 @@ void DockItemController::appItemRemoved(const QString &appId)
 void DockItemController::appItemRemoved(AppItem *appItem)
 {
     emit itemRemoved(appItem);
+    dragSessionItemRemoved(appItem);
     m_itemList.removeOne(appItem);
     appItem->deleteLater();
 }
 
 void DockItemController::pluginItemInserted(PluginsItem *item)
 {
+    PROFILE_HOT_PATH("DockItemController::pluginItemInserted");
+
     // check item is in container
     if (item->allowContainer() && item->isInContainer())
     {
@@ -324,6 +456,7 @@ void DockItemController::pluginItemInserted(PluginsItem *item)
 //    qDebug() << insertIndex << item;
 
     m_itemList.insert(insertIndex, item);
+    dragSessionItemInserted(insertIndex);
     emit itemInserted(insertIndex, item);
 }
 
@@ -336,6 +469,7 @@ void DockItemController::pluginItemRemoved(PluginsItem *item)
     else
         emit itemRemoved(item);
 
+    dragSessionItemRemoved(item);
     m_itemList.removeOne(item);
 
     item->deleteLater();
@@ -348,13 +482,102 @@ void DockItemController::reloadAppItems()
         if (item->itemType() == DockItem::App)
             appItemRemoved(static_cast<AppItem *>(item.data()));
 
+    // replies of an earlier fetch belong to the old daemon, drop them
+    ++m_entryGeneration;
+
     // append new item
-    for (auto path : m_appInter->entries())
-        appItemAdded(path, -1);
+    fetchAppItems(m_appInter->entries(), -1);
+}
+
+///
+/// \brief DockItemController::fetchAppItems request the properties of all
+/// entries at once, the items are created in entryFetched without blocking
+/// the event loop.
+/// \param index insert position of the first entry, -1 to append
+///
+void DockItemController::fetchAppItems(const QList<QDBusObjectPath> &entries, const int index)
+{
+    if (entries.isEmpty())
+        return;
+
+    QSharedPointer<EntryBatch> batch(new EntryBatch);
+    batch->generation = m_entryGeneration;
+    batch->index = index;
+    batch->pending = entries.size();
+    batch->paths = entries;
+    for (int i(0); i != entries.size(); ++i)
+        batch->properties << QVariantMap();
+
+    for (int i(0); i != entries.size(); ++i)
+    {
+        QDBusMessage msg = QDBusMessage::createMethodCall(m_appInter->service(), entries[i].path(),
+                                                          "org.freedesktop.DBus.Properties", "GetAll");
+        msg << DockEntryInter::staticInterfaceName();
+
+        QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(m_appInter->connection().asyncCall(msg), this);
+        connect(watcher, &QDBusPendingCallWatcher::finished, this, [=] { entryFetched(batch, i, watcher); });
+    }
+}
+
+void DockItemController::entryFetched(const QSharedPointer<EntryBatch> &batch, const int slot, QDBusPendingCallWatcher *watcher)
+{
+    QDBusPendingReply<QVariantMap> reply = *watcher;
+    watcher->deleteLater();
+
+    // an error here means the entry is already gone, EntryRemoved follows
+    if (reply.isError())
+        qWarning() << "fetch dock entry failed:" << batch->paths[slot].path() << reply.error().message();
+    else
+        batch->properties[slot] = reply.value();
+
+    if (--batch->pending)
+        return;
+    if (batch->generation != m_entryGeneration)
+        return;
+
+    PROFILE_HOT_PATH("DockItemController::insertAppItems");
+
+    int index = batch->index;
+    for (int i(0); i != batch->paths.size(); ++i)
+    {
+        if (batch->properties[i].isEmpty())
+            continue;
+
+        insertAppItem(batch->paths[i], index, batch->properties[i]);
+
+        if (index != -1)
+            ++index;
+    }
+
+    // a whole entry list is in, only the first one counts for startup
+    if (batch->index == -1)
+        markAppsPopulated();
+}
+
+///
+/// \brief DockItemController::markAppsPopulated the controller is built while
+/// the settings load, so the initial app list may be ready before them, the
+/// phase is recorded once SettingsLoaded is reached to keep the order.
+///
+void DockItemController::markAppsPopulated()
+{
+    StartupProfiler *profiler = StartupProfiler::instance();
+    if (profiler->reached(StartupProfiler::AppsPopulated))
+        return;
+
+    if (profiler->reached(StartupProfiler::SettingsLoaded))
+        profiler->mark(StartupProfiler::AppsPopulated);
+    else
+        connect(profiler, &StartupProfiler::phaseReached, this, [=](const StartupProfiler::Phase phase) {
+            if (phase == StartupProfiler::SettingsLoaded)
+                profiler->mark(StartupProfiler::AppsPopulated);
+        });
 }
 
 void DockItemController::sortPluginItems()
 {
+    PROFILE_HOT_PATH("DockItemController::sortPluginItems");
+
     int firstPluginIndex = -1;
     for (int i(0); i != m_itemList.size(); ++i)
     {
@@ -32,6 +32,7 @@
 #include "item/containeritem.h"
 
 #include <QObject>
+#include <QSharedPointer>
 
 class DockItemController : public QObject
 {
@@ -58,6 +59,8 @@ public slots:
     void sortPluginItems();
     void updatePluginsItemOrderKey();
     void itemMove(DockItem * const moveItem, DockItem * const replaceItem);
+    void beginDragSession(DockItem * const item);
+    void finishDragSession(const bool commit);
     void itemDroppedIntoContainer(DockItem * const item);
     void itemDragOutFromContainer(DockItem * const item);
     void placeholderItemAdded(PlaceholderItem *item, DockItem *position);
@@ -65,13 +68,21 @@ public slots:
     void placeholderItemRemoved(PlaceholderItem *item);
 
 private:
+    struct EntryBatch;
+
     explicit DockItemController(QObject *parent = 0);
     void appItemAdded(const QDBusObjectPath &path, const int index);
+    void insertAppItem(const QDBusObjectPath &path, const int index, const QVariantMap &properties);
     void appItemRemoved(const QString &appId);
     void appItemRemoved(AppItem *appItem);
     void pluginItemInserted(PluginsItem *item);
     void pluginItemRemoved(PluginsItem *item);
     void reloadAppItems();
+    void fetchAppItems(const QList<QDBusObjectPath> &entries, const int index);
+    void entryFetched(const QSharedPointer<EntryBatch> &batch, const int slot, QDBusPendingCallWatcher *watcher);
+    void markAppsPopulated();
+    void dragSessionItemInserted(const int index);
+    void dragSessionItemRemoved(DockItem * const item);
 
 private:
     QList<QPointer<DockItem>> m_itemList;
@@ -83,6 +94,11 @@ private:
     StretchItem *m_placeholderItem;
     ContainerItem *m_containerItem;
 
+    int m_entryGeneration;
+
+    QPointer<DockItem> m_dragSessionItem;
+    int m_dragSessionOrigin;
+
     static DockItemController *INSTANCE;
 };
 
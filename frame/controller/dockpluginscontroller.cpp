@@ -20,6 +20,9 @@
  */
 
 #include "dockpluginscontroller.h"
+#include "util/hotpathprofiler.h"
+#include "util/startupprofiler.h"
+#include "util/screentopology.h"
 #include "pluginsiteminterface.h"
 #include "dockitemcontroller.h"
 #include "dockpluginloader.h"
@@ -32,12 +35,23 @@
 
 DockPluginsController::DockPluginsController(DockItemController *itemControllerInter)
     : QObject(itemControllerInter),
+      m_loaderStarted(false),
       m_itemControllerInter(itemControllerInter)
 {
     qApp->installEventFilter(this);
 
     QGSettings gsetting("com.deepin.dde.dock", "/com/deepin/dde/dock/");
 
+    // load plugins once the panel is painted, the configured delay is only an upper bound
+    StartupProfiler *profiler = StartupProfiler::instance();
+    if (profiler->reached(StartupProfiler::FirstPanelPaint))
+        QMetaObject::invokeMethod(this, "startLoader", Qt::QueuedConnection);
+    else
+        connect(profiler, &StartupProfiler::phaseReached, this, [=](const StartupProfiler::Phase phase) {
+            if (phase == StartupProfiler::FirstPanelPaint)
+                startLoader();
+        });
+
     QTimer::singleShot(gsetting.get("delay-plugins-time").toUInt(), this, &DockPluginsController::startLoader);
 }
 
@@ -105,6 +119,11 @@ void DockPluginsController::requestContextMenu(PluginsItemInterface * const item
     item->showContextMenu();
 }
 
+const QPoint DockPluginsController::rawXPosition(const QPoint &scaledPos) const
+{
+    return ScreenTopology::instance()->rawXPosition(scaledPos);
+}
+
 //void DockPluginsController::requestPopupApplet(PluginsItemInterface * const itemInter, const QString &itemKey)
 //{
 //    PluginsItem *item = pluginItemAt(itemInter, itemKey);
@@ -115,9 +134,14 @@ void DockPluginsController::requestContextMenu(PluginsItemInterface * const item
 
 void DockPluginsController::startLoader()
 {
+    if (m_loaderStarted)
+        return;
+    m_loaderStarted = true;
+
     DockPluginLoader *loader = new DockPluginLoader(this);
 
     connect(loader, &DockPluginLoader::finished, loader, &DockPluginLoader::deleteLater, Qt::QueuedConnection);
+    connect(loader, &DockPluginLoader::finished, this, [] { StartupProfiler::instance()->mark(StartupProfiler::PluginsReady); }, Qt::QueuedConnection);
     connect(loader, &DockPluginLoader::pluginFounded, this, &DockPluginsController::loadPlugin, Qt::QueuedConnection);
 
     QTimer::singleShot(1, loader, [=] { loader->start(QThread::LowestPriority); });
@@ -162,7 +186,12 @@ void DockPluginsController::loadPlugin(const QString &pluginFile)
 
     m_pluginList.insert(interface, QMap<QString, PluginsItem *>());
     qDebug() << "init plugin: " << interface->pluginName();
-    interface->init(this);
+    {
+        // attribute the init cost to the plugin itself
+        const QByteArray scope = QString("%1::init").arg(interface->pluginName()).toLatin1();
+        PROFILE_HOT_PATH(scope.constData());
+        interface->init(this);
+    }
     qDebug() << "init plugin finished: " << interface->pluginName();
 }
 
@@ -45,6 +45,7 @@ public:
     void itemUpdate(PluginsItemInterface * const itemInter, const QString &itemKey);
     void itemRemoved(PluginsItemInterface * const itemInter, const QString &itemKey);
     void requestContextMenu(PluginsItemInterface * const itemInter, const QString &itemKey);
+    const QPoint rawXPosition(const QPoint &scaledPos) const;
 
 signals:
     void pluginItemInserted(PluginsItem *pluginItem) const;
@@ -63,6 +64,7 @@ private:
 
 private:
     QMap<PluginsItemInterface *, QMap<QString, PluginsItem *>> m_pluginList;
+    bool m_loaderStarted;
     DockItemController *m_itemControllerInter;
 };
 
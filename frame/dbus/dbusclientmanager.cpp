@@ -10,6 +10,7 @@
  */
 
 #include "dbusclientmanager.h"
+#include "dbuspropertyrouter.h"
 
 /*
  * Implementation of interface class DBusClientManager
@@ -18,11 +19,11 @@
 DBusClientManager::DBusClientManager(QObject *parent)
     : QDBusAbstractInterface("com.deepin.daemon.Dock", "/dde/dock/ClientManager", staticInterfaceName(), QDBusConnection::sessionBus(), parent)
 {
-    QDBusConnection::sessionBus().connect(this->service(), this->path(), "org.freedesktop.DBus.Properties",  "PropertiesChanged","sa{sv}as", this, SLOT(__propertyChanged__(QDBusMessage)));
+    // HAND-EDIT: property changes are dispatched by the shared router
+    DBusPropertyRouter::instance(connection())->registerProxy(this);
 }
 
 DBusClientManager::~DBusClientManager()
 {
-    QDBusConnection::sessionBus().disconnect(service(), path(), "org.freedesktop.DBus.Properties",  "PropertiesChanged",  "sa{sv}as", this, SLOT(propertyChanged(QDBusMessage)));
 }
 
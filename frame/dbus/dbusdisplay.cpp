@@ -9,24 +9,34 @@
  * before re-generating it.
  */
 
-#include  "dbusdisplay.h"
+#include "dbusdisplay.h"
+#include "dbuspropertyrouter.h"
+
+#include <QCoreApplication>
 
 /*
  * Implementation of interface class DBusDisplay
  */
 
+DBusDisplay *DBusDisplay::instance()
+{
+    static DBusDisplay *INSTANCE = new DBusDisplay(qApp);
+
+    return INSTANCE;
+}
+
 DBusDisplay::DBusDisplay(QObject *parent)
     : QDBusAbstractInterface(staticServiceName(), staticObjectPath(), staticInterfaceName(), QDBusConnection::sessionBus(), parent)
 {
     qDBusRegisterMetaType<BrightnessMap>();
     qDBusRegisterMetaType<DisplayRect>();
 
-    QDBusConnection::sessionBus().connect(this->service(), this->path(), "org.freedesktop.DBus.Properties",  "PropertiesChanged","sa{sv}as", this, SLOT(__propertyChanged__(QDBusMessage)));
+    // HAND-EDIT: property changes are dispatched by the shared router
+    DBusPropertyRouter::instance(connection())->registerProxy(this);
 }
 
 DBusDisplay::~DBusDisplay()
 {
-    QDBusConnection::sessionBus().disconnect(service(), path(), "org.freedesktop.DBus.Properties",  "PropertiesChanged",  "sa{sv}as", this, SLOT(propertyChanged(QDBusMessage)));
 }
 
 
@@ -50,26 +50,6 @@ class DBusDisplay: public QDBusAbstractInterface
 {
     Q_OBJECT
 
-    Q_SLOT void __propertyChanged__(const QDBusMessage& msg)
-    {
-        QList<QVariant> arguments = msg.arguments();
-        if (3 != arguments.count())
-            return;
-        QString interfaceName = msg.arguments().at(0).toString();
-        if (interfaceName !="com.deepin.daemon.Display")
-            return;
-        QVariantMap changedProps = qdbus_cast<QVariantMap>(arguments.at(1).value<QDBusArgument>());
-        QStringList keys = changedProps.keys();
-        foreach(const QString &prop, keys) {
-        const QMetaObject* self = metaObject();
-            for (int i=self->propertyOffset(); i < self->propertyCount(); ++i) {
-                QMetaProperty p = self->property(i);
-                if (p.name() == prop) {
- 	            Q_EMIT p.notifySignal().invoke(this);
-                }
-            }
-        }
-   }
 public:
     static inline const char *staticInterfaceName()
     { return "com.deepin.daemon.Display"; }
@@ -79,6 +59,9 @@ public:
     { return "/com/deepin/daemon/Display"; }
 
 public:
+    // HAND-EDIT: shared proxy, prefer it over creating another instance
+    static DBusDisplay *instance();
+
     explicit DBusDisplay(QObject *parent = 0);
 
     ~DBusDisplay();
@@ -10,19 +10,29 @@
  */
 
 #include "dbusdock.h"
+#include "dbuspropertyrouter.h"
+
+#include <QCoreApplication>
 
 /*
  * Implementation of interface class DBusDock
  */
 
+DBusDock *DBusDock::instance()
+{
+    static DBusDock *INSTANCE = new DBusDock(qApp);
+
+    return INSTANCE;
+}
+
 DBusDock::DBusDock(QObject *parent)
     : QDBusAbstractInterface("com.deepin.dde.daemon.Dock", "/com/deepin/dde/daemon/Dock", staticInterfaceName(), QDBusConnection::sessionBus(), parent)
 {
-    QDBusConnection::sessionBus().connect(this->service(), this->path(), "org.freedesktop.DBus.Properties",  "PropertiesChanged","sa{sv}as", this, SLOT(__propertyChanged__(QDBusMessage)));
+    // HAND-EDIT: property changes are dispatched by the shared router
+    DBusPropertyRouter::instance(connection())->registerProxy(this);
 }
 
 DBusDock::~DBusDock()
 {
-    QDBusConnection::sessionBus().disconnect(service(), path(), "org.freedesktop.DBus.Properties",  "PropertiesChanged",  "sa{sv}as", this, SLOT(propertyChanged(QDBusMessage)));
 }
 
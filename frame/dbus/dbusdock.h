@@ -27,30 +27,14 @@ class DBusDock: public QDBusAbstractInterface
 {
     Q_OBJECT
 
-    Q_SLOT void __propertyChanged__(const QDBusMessage& msg)
-    {
-        QList<QVariant> arguments = msg.arguments();
-        if (3 != arguments.count())
-            return;
-        QString interfaceName = msg.arguments().at(0).toString();
-        if (interfaceName !="com.deepin.dde.daemon.Dock")
-            return;
-        QVariantMap changedProps = qdbus_cast<QVariantMap>(arguments.at(1).value<QDBusArgument>());
-        foreach(const QString &prop, changedProps.keys()) {
-        const QMetaObject* self = metaObject();
-            for (int i=self->propertyOffset(); i < self->propertyCount(); ++i) {
-                QMetaProperty p = self->property(i);
-                if (p.name() == prop) {
- 	            Q_EMIT p.notifySignal().invoke(this);
-                }
-            }
-        }
-   }
 public:
     static inline const char *staticInterfaceName()
     { return "com.deepin.dde.daemon.Dock"; }
 
 public:
+    // HAND-EDIT: shared proxy, prefer it over creating another instance
+    static DBusDock *instance();
+
     explicit DBusDock(QObject *parent = 0);
 
     ~DBusDock();
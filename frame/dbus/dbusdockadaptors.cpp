@@ -20,7 +20,10 @@
  */
 
 #include "dbusdockadaptors.h"
+#include "util/eventlooptracer.h"
+#include "util/startupprofiler.h"
 #include <QScreen>
+#include <QStandardPaths>
 #include <QDebug>
 
 DBusDockAdaptors::DBusDockAdaptors(MainWindow* parent): QDBusAbstractAdaptor(parent)
@@ -45,3 +48,35 @@ QRect DBusDockAdaptors::geometry() const
     return parent()->geometry();
 }
 
+QString DBusDockAdaptors::StartupTimings()
+{
+    return StartupProfiler::instance()->summary();
+}
+
+void DBusDockAdaptors::SetTracingEnabled(bool enabled)
+{
+    EventLoopTracer::instance()->setEnabled(enabled);
+}
+
+QString DBusDockAdaptors::TraceSummary()
+{
+    return EventLoopTracer::instance()->summary();
+}
+
+///
+/// \brief DBusDockAdaptors::WriteTrace callers must not choose the file, the
+/// trace always goes to the user runtime dir and its path is returned, or an
+/// empty string if it could not be written.
+///
+QString DBusDockAdaptors::WriteTrace()
+{
+    const QString runtimeDir = QStandardPaths::writableLocation(QStandardPaths::RuntimeLocation);
+    if (runtimeDir.isEmpty())
+        return QString();
+
+    const QString path = runtimeDir + "/dde-dock-trace.json";
+    if (!EventLoopTracer::instance()->writeTrace(path))
+        return QString();
+
+    return path;
+}
@@ -39,6 +39,18 @@ class DBusDockAdaptors: public QDBusAbstractAdaptor
                                        "    <signal name=\"geometryChanged\">"
                                                 "<arg name=\"geometry\" type=\"(iiii)\"/>"
                                             "</signal>"
+                                       "    <method name=\"StartupTimings\">"
+                                                "<arg name=\"timings\" type=\"s\" direction=\"out\"/>"
+                                            "</method>"
+                                       "    <method name=\"SetTracingEnabled\">"
+                                                "<arg name=\"enabled\" type=\"b\" direction=\"in\"/>"
+                                            "</method>"
+                                       "    <method name=\"TraceSummary\">"
+                                                "<arg name=\"summary\" type=\"s\" direction=\"out\"/>"
+                                            "</method>"
+                                       "    <method name=\"WriteTrace\">"
+                                                "<arg name=\"path\" type=\"s\" direction=\"out\"/>"
+                                            "</method>"
                                        "  </interface>\n"
                                        "")
 
@@ -52,6 +64,12 @@ public: // PROPERTIES
     Q_PROPERTY(QRect geometry READ geometry NOTIFY geometryChanged)
     QRect geometry() const;
 
+public Q_SLOTS: // METHODS
+    QString StartupTimings();
+    void SetTracingEnabled(bool enabled);
+    QString TraceSummary();
+    QString WriteTrace();
+
 signals:
     void geometryChanged(QRect geometry);
 };
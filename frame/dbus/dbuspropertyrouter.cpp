@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dbuspropertyrouter.h"
+
+#include <QCoreApplication>
+#include <QMetaProperty>
+#include <QDebug>
+
+#define PROPERTIES_INTERFACE    "org.freedesktop.DBus.Properties"
+
+static inline const QString routeKey(const QString &path, const QString &interface)
+{
+    return path + '|' + interface;
+}
+
+DBusPropertyRouter *DBusPropertyRouter::instance(const QDBusConnection &connection)
+{
+    static QHash<QString, DBusPropertyRouter *> Routers;
+
+    DBusPropertyRouter *router = Routers.value(connection.name());
+    if (!router)
+    {
+        router = new DBusPropertyRouter(connection, qApp);
+        Routers.insert(connection.name(), router);
+    }
+
+    return router;
+}
+
+DBusPropertyRouter::DBusPropertyRouter(const QDBusConnection &connection, QObject *parent)
+    : QObject(parent),
+      m_connection(connection)
+{
+}
+
+void DBusPropertyRouter::registerProxy(QDBusAbstractInterface *proxy)
+{
+    const QString service = proxy->service();
+    const QString key = routeKey(proxy->path(), proxy->interface());
+
+    // the path is left empty, so every object of the service shares one match rule
+    if (!m_serviceRefs.contains(service))
+        m_connection.connect(service, QString(), PROPERTIES_INTERFACE, "PropertiesChanged", "sa{sv}as",
+                             this, SLOT(onPropertiesChanged(QDBusMessage)));
+
+    ++m_serviceRefs[service];
+    m_proxies.insert(key, proxy);
+
+    connect(proxy, &QObject::destroyed, this, [=] { unregisterProxy(service, key); });
+}
+
+void DBusPropertyRouter::unregisterProxy(const QString &service, const QString &key)
+{
+    // the destroyed proxy is already null in the hash
+    auto it = m_proxies.find(key);
+    while (it != m_proxies.end() && it.key() == key)
+    {
+        if (it.value().isNull())
+            it = m_proxies.erase(it);
+        else
+            ++it;
+    }
+
+    if (--m_serviceRefs[service])
+        return;
+
+    m_serviceRefs.remove(service);
+    m_connection.disconnect(service, QString(), PROPERTIES_INTERFACE, "PropertiesChanged", "sa{sv}as",
+                            this, SLOT(onPropertiesChanged(QDBusMessage)));
+}
+
+void DBusPropertyRouter::onPropertiesChanged(const QDBusMessage &msg)
+{
+    const QList<QVariant> arguments = msg.arguments();
+    if (3 != arguments.count())
+        return;
+
+    const QString interface = arguments.at(0).toString();
+    const QString key = routeKey(msg.path(), interface);
+    if (!m_proxies.contains(key))
+        return;
+
+    const QVariantMap changedProps = qdbus_cast<QVariantMap>(arguments.at(1).value<QDBusArgument>());
+
+    for (auto proxy : m_proxies.values(key))
+    {
+        if (proxy.isNull())
+            continue;
+
+        const QMetaObject *self = proxy->metaObject();
+        for (int i(self->propertyOffset()); i != self->propertyCount(); ++i)
+        {
+            const QMetaProperty p = self->property(i);
+            if (changedProps.contains(p.name()) && p.hasNotifySignal())
+                Q_EMIT p.notifySignal().invoke(proxy.data());
+        }
+    }
+
+    emit propertiesChanged(msg.path(), interface, changedProps);
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DBUSPROPERTYROUTER_H
+#define DBUSPROPERTYROUTER_H
+
+#include <QObject>
+#include <QPointer>
+#include <QMultiHash>
+#include <QDBusConnection>
+#include <QDBusAbstractInterface>
+
+///
+/// \brief The DBusPropertyRouter class owns one PropertiesChanged match rule
+/// per service on a bus connection, decodes each message once and fires the
+/// notify signals of every proxy registered for that path and interface.
+///
+class DBusPropertyRouter : public QObject
+{
+    Q_OBJECT
+
+public:
+    static DBusPropertyRouter *instance(const QDBusConnection &connection = QDBusConnection::sessionBus());
+
+    void registerProxy(QDBusAbstractInterface *proxy);
+
+signals:
+    void propertiesChanged(const QString &path, const QString &interface, const QVariantMap &changedProps) const;
+
+private slots:
+    void onPropertiesChanged(const QDBusMessage &msg);
+
+private:
+    explicit DBusPropertyRouter(const QDBusConnection &connection, QObject *parent = nullptr);
+
+    void unregisterProxy(const QString &service, const QString &key);
+
+private:
+    QDBusConnection m_connection;
+    QHash<QString, int> m_serviceRefs;
+    QMultiHash<QString, QPointer<QDBusAbstractInterface>> m_proxies;
+};
+
+#endif // DBUSPROPERTYROUTER_H
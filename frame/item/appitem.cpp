@@ -24,6 +24,7 @@
 #include "util/themeappicon.h"
 #include "util/imagefactory.h"
 #include "xcb/xcb_misc.h"
+#include "xcb/xcb_timestamp.h"
 
 #include <X11/X.h>
 #include <X11/Xlib.h>
@@ -103,7 +104,7 @@ const static qreal Frames[] = { 0,
 int AppItem::IconBaseSize;
 QPoint AppItem::MousePressPos;
 
-AppItem::AppItem(const QDBusObjectPath &entry, QWidget *parent)
+AppItem::AppItem(const QDBusObjectPath &entry, const QVariantMap &properties, QWidget *parent)
     : DockItem(parent),
       m_appNameTips(new QLabel(this)),
       m_appPreviewTips(new PreviewContainer(this)),
@@ -113,6 +114,7 @@ AppItem::AppItem(const QDBusObjectPath &entry, QWidget *parent)
       m_itemScene(new QGraphicsScene(this)),
 
       m_dragging(false),
+      m_attentionCount(0),
 
       m_appIcon(QPixmap()),
 
@@ -132,7 +134,17 @@ AppItem::AppItem(const QDBusObjectPath &entry, QWidget *parent)
     centralLayout->setMargin(0);
     centralLayout->setSpacing(0);
 
-    setAccessibleName(m_itemEntryInter->name());
+    // prefer the prefetched properties, fall back to sync reads when missing
+    const bool prefetched = !properties.isEmpty();
+    m_id = prefetched ? properties.value("Id").toString() : m_itemEntryInter->id();
+    m_name = prefetched ? properties.value("Name").toString() : m_itemEntryInter->name();
+    m_icon = prefetched ? properties.value("Icon").toString() : m_itemEntryInter->icon();
+    m_active = prefetched ? properties.value("IsActive").toBool() : m_itemEntryInter->isActive();
+    m_currentWindow = prefetched ? properties.value("CurrentWindow").toUInt() : m_itemEntryInter->currentWindow();
+    const WindowInfoMap windowInfos = prefetched ? qdbus_cast<WindowInfoMap>(properties.value("WindowInfos").value<QDBusArgument>())
+                                                 : m_itemEntryInter->windowInfos();
+
+    setAccessibleName(m_name);
     setAcceptDrops(true);
     setLayout(centralLayout);
 
@@ -146,11 +158,8 @@ AppItem::AppItem(const QDBusObjectPath &entry, QWidget *parent)
     m_swingEffectView->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
     m_swingEffectView->setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
 
-    m_id = m_itemEntryInter->id();
-    m_active = m_itemEntryInter->isActive();
-
-    m_appNameTips->setObjectName(m_itemEntryInter->name());
-    m_appNameTips->setAccessibleName(m_itemEntryInter->name() + "-tips");
+    m_appNameTips->setObjectName(m_name);
+    m_appNameTips->setAccessibleName(m_name + "-tips");
     m_appNameTips->setVisible(false);
     m_appNameTips->setStyleSheet("color:white;"
                                  "padding:0px 3px;");
@@ -163,7 +172,10 @@ AppItem::AppItem(const QDBusObjectPath &entry, QWidget *parent)
     connect(m_itemEntryInter, &DockEntryInter::IsActiveChanged, this, &AppItem::activeChanged);
     connect(m_itemEntryInter, &DockEntryInter::IsActiveChanged, this, static_cast<void (AppItem::*)()>(&AppItem::update));
     connect(m_itemEntryInter, &DockEntryInter::WindowInfosChanged, this, &AppItem::updateWindowInfos, Qt::QueuedConnection);
-    connect(m_itemEntryInter, &DockEntryInter::IconChanged, this, &AppItem::refershIcon);
+    connect(m_itemEntryInter, &DockEntryInter::IconChanged, this, [=](const QString &icon) { m_icon = icon; refershIcon(); });
+    connect(m_itemEntryInter, &DockEntryInter::NameChanged, this, [=](const QString &name) { m_name = name; });
+    connect(m_itemEntryInter, &DockEntryInter::CurrentWindowChanged, this, [=](const quint32 wid) { m_currentWindow = wid; });
+    connect(m_itemEntryInter, &DockEntryInter::MenuChanged, this, [=] { m_menuJson.clear(); });
 
     connect(m_updateIconGeometryTimer, &QTimer::timeout, this, &AppItem::updateWindowIconGeometries, Qt::QueuedConnection);
 
@@ -172,7 +184,7 @@ AppItem::AppItem(const QDBusObjectPath &entry, QWidget *parent)
     connect(m_appPreviewTips, &PreviewContainer::requestCancelAndHidePreview, this, &AppItem::cancelAndHidePreview);
     connect(m_appPreviewTips, &PreviewContainer::requestCheckWindows, m_itemEntryInter, &DockEntryInter::Check);
 
-    updateWindowInfos(m_itemEntryInter->windowInfos());
+    updateWindowInfos(windowInfos);
     refershIcon();
 }
 
@@ -336,16 +348,16 @@ void AppItem::paintEvent(QPaintEvent *e)
     const int iconX = itemRect.center().x() - pixmap.rect().center().x() / ratio;
     const int iconY = itemRect.center().y() - pixmap.rect().center().y() / ratio;
 
-    painter.drawPixmap(iconX, iconY, pixmap);
+    drawIcon(painter, QPoint(iconX, iconY), pixmap);
 }
 
 void AppItem::mouseReleaseEvent(QMouseEvent *e)
 {
     if (e->button() == Qt::MiddleButton) {
-        m_itemEntryInter->NewInstance(QX11Info::getTimestamp());
+        m_itemEntryInter->NewInstance(XcbTimestamp::instance()->timestamp());
     } else if (e->button() == Qt::LeftButton) {
 
-        m_itemEntryInter->Activate(QX11Info::getTimestamp());
+        m_itemEntryInter->Activate(XcbTimestamp::instance()->timestamp());
 
         // play launch effect
         if (m_windowInfos.isEmpty())
@@ -440,7 +452,7 @@ void AppItem::dropEvent(QDropEvent *e)
     }
 
     qDebug() << "accept drop event with URIs: " << uriList;
-    m_itemEntryInter->HandleDragDrop(QX11Info::getTimestamp(), uriList);
+    m_itemEntryInter->HandleDragDrop(XcbTimestamp::instance()->timestamp(), uriList);
 }
 
 void AppItem::leaveEvent(QEvent *e)
@@ -463,12 +475,17 @@ void AppItem::invokedMenuItem(const QString &itemId, const bool checked)
 {
     Q_UNUSED(checked);
 
+    // the menu runs in another process, none of its input reaches our event filter
     m_itemEntryInter->HandleMenuItem(QX11Info::getTimestamp(), itemId);
 }
 
 const QString AppItem::contextMenu() const
 {
-    return m_itemEntryInter->menu();
+    // cached until entry reports menu changed
+    if (m_menuJson.isNull())
+        m_menuJson = m_itemEntryInter->menu();
+
+    return m_menuJson;
 }
 
 QWidget *AppItem::popupTips()
@@ -478,11 +495,10 @@ QWidget *AppItem::popupTips()
 
     if (!m_windowInfos.isEmpty())
     {
-        const quint32 currentWindow = m_itemEntryInter->currentWindow();
-        Q_ASSERT(m_windowInfos.contains(currentWindow));
-        m_appNameTips->setText(m_windowInfos[currentWindow].title);
+        Q_ASSERT(m_windowInfos.contains(m_currentWindow));
+        m_appNameTips->setText(m_windowInfos[m_currentWindow].title);
     } else {
-        m_appNameTips->setText(m_itemEntryInter->name());
+        m_appNameTips->setText(m_name);
     }
 
     return m_appNameTips;
@@ -503,6 +519,7 @@ void AppItem::startDrag()
     emit dragStarted();
     const Qt::DropAction result = drag->exec(Qt::MoveAction);
     Q_UNUSED(result);
+    emit itemDropped(drag->target());
 
     // drag out of dock panel
     if (!drag->target())
@@ -515,17 +532,37 @@ void AppItem::startDrag()
 
 bool AppItem::hasAttention() const
 {
-    for (const auto &info : m_windowInfos)
-        if (info.attention)
-            return true;
-    return false;
+    return m_attentionCount > 0;
 }
 
 void AppItem::updateWindowInfos(const WindowInfoMap &info)
 {
+    const WindowInfoDelta delta = WindowInfoDelta::diff(m_windowInfos, info);
+    if (delta.isEmpty())
+        return;
+
+    // track attention incrementally instead of scanning all windows
+    const int oldAttentionCount = m_attentionCount;
+    for (const WId wid : delta.removed)
+        if (m_windowInfos.value(wid).attention)
+            --m_attentionCount;
+    for (const WId wid : delta.added)
+        if (info.value(wid).attention)
+            ++m_attentionCount;
+    for (auto it(delta.changed.cbegin()); it != delta.changed.cend(); ++it)
+        if (it.value() & WindowInfoDelta::Attention)
+            m_attentionCount += info.value(it.key()).attention ? 1 : -1;
+    const bool attentionChanged = oldAttentionCount != m_attentionCount;
+
     m_windowInfos = info;
-    m_appPreviewTips->setWindowInfos(m_windowInfos);
-    m_updateIconGeometryTimer->start();
+    m_appPreviewTips->applyWindowInfoDelta(m_windowInfos, delta);
+
+    // title only changes do not affect the item itself
+    if (!delta.countChanged() && !attentionChanged)
+        return;
+
+    if (delta.countChanged())
+        m_updateIconGeometryTimer->start();
 
     // process attention effect
     if (hasAttention())
@@ -541,13 +578,12 @@ void AppItem::updateWindowInfos(const WindowInfoMap &info)
 
 void AppItem::refershIcon()
 {
-    const QString icon = m_itemEntryInter->icon();
     const int iconSize = qMin(width(), height());
 
     if (DockDisplayMode == Efficient)
-        m_appIcon = ThemeAppIcon::getIcon(icon, iconSize * 0.7);
+        m_appIcon = ThemeAppIcon::getIcon(m_icon, iconSize * 0.7);
     else
-        m_appIcon = ThemeAppIcon::getIcon(icon, iconSize * 0.8);
+        m_appIcon = ThemeAppIcon::getIcon(m_icon, iconSize * 0.8);
 
     update();
 
@@ -579,7 +615,6 @@ void AppItem::showPreview()
 
     showPopupWindow(m_appPreviewTips, true);
 
-    m_appPreviewTips->setWindowInfos(m_windowInfos);
     m_appPreviewTips->updateSnapshots();
     m_appPreviewTips->updateLayoutDirection(DockPosition);
 }
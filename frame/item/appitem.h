@@ -39,7 +39,7 @@ class AppItem : public DockItem
     Q_OBJECT
 
 public:
-    explicit AppItem(const QDBusObjectPath &entry, QWidget *parent = nullptr);
+    explicit AppItem(const QDBusObjectPath &entry, const QVariantMap &properties = QVariantMap(), QWidget *parent = nullptr);
     ~AppItem();
 
     const QString appId() const;
@@ -98,8 +98,13 @@ private:
 
     bool m_dragging;
     bool m_active;
+    int m_attentionCount;
     WindowInfoMap m_windowInfos;
     QString m_id;
+    QString m_name;
+    QString m_icon;
+    quint32 m_currentWindow;
+    mutable QString m_menuJson;
     QPixmap m_appIcon;
     QPixmap m_horizontalIndicator;
     QPixmap m_verticalIndicator;
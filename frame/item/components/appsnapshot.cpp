@@ -20,6 +20,7 @@
  */
 
 #include "appsnapshot.h"
+#include "util/hotpathprofiler.h"
 #include "previewcontainer.h"
 
 #include <X11/Xlib.h>
@@ -93,9 +94,12 @@ void AppSnapshot::compositeChanged() const
 
 void AppSnapshot::setWindowInfo(const WindowInfo &info)
 {
+    const bool titleChanged = m_windowInfo.title != info.title || m_title->text().isEmpty();
+
     m_windowInfo = info;
 
-    m_title->setText(m_windowInfo.title);
+    if (titleChanged)
+        m_title->setText(m_windowInfo.title);
 }
 
 void AppSnapshot::dragEnterEvent(QDragEnterEvent *e)
@@ -108,6 +112,8 @@ void AppSnapshot::dragEnterEvent(QDragEnterEvent *e)
 
 void AppSnapshot::fetchSnapshot()
 {
+    PROFILE_HOT_PATH("AppSnapshot::fetchSnapshot");
+
     if (!m_wmHelper->hasComposite())
         return;
 
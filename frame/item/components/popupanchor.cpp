@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "popupanchor.h"
+
+#include <QWidget>
+#include <QEvent>
+
+PopupAnchor::PopupAnchor(QWidget *item)
+    : QObject(item),
+
+      m_item(item),
+      m_coalesceTimer(new QTimer(this)),
+
+      m_position(Dock::Bottom)
+{
+    m_coalesceTimer->setSingleShot(true);
+    m_coalesceTimer->setInterval(0);
+
+    connect(m_coalesceTimer, &QTimer::timeout, this, &PopupAnchor::geometryChanged);
+}
+
+///
+/// \brief PopupAnchor::track remember the point the popup was shown at and
+/// start watching the item chain.
+///
+void PopupAnchor::track(const QPoint &point, const Dock::Position position)
+{
+    m_point = point;
+    m_position = position;
+
+    if (m_watched.isEmpty())
+        watchAncestors();
+}
+
+void PopupAnchor::release()
+{
+    m_coalesceTimer->stop();
+
+    for (auto w : m_watched)
+        if (w)
+            w->removeEventFilter(this);
+
+    m_watched.clear();
+}
+
+///
+/// \brief PopupAnchor::update store the new anchor
+/// \return true if it differs from the last one
+///
+bool PopupAnchor::update(const QPoint &point, const Dock::Position position)
+{
+    if (point == m_point && position == m_position)
+        return false;
+
+    m_point = point;
+    m_position = position;
+
+    return true;
+}
+
+bool PopupAnchor::eventFilter(QObject *o, QEvent *e)
+{
+    switch (e->type())
+    {
+    case QEvent::ParentChange:
+        // item moved into another container, the ancestor chain is different now
+        if (o == m_item)
+        {
+            release();
+            watchAncestors();
+        }
+        Q_FALLTHROUGH();
+    case QEvent::Move:
+    case QEvent::Resize:
+        m_coalesceTimer->start();
+        break;
+    default:;
+    }
+
+    return false;
+}
+
+void PopupAnchor::watchAncestors()
+{
+    for (QWidget *w = m_item; w; w = w->parentWidget())
+    {
+        w->installEventFilter(this);
+        m_watched << w;
+    }
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef POPUPANCHOR_H
+#define POPUPANCHOR_H
+
+#include "constants.h"
+
+#include <QObject>
+#include <QPointer>
+#include <QPoint>
+#include <QTimer>
+
+///
+/// \brief The PopupAnchor class tracks where the popup of a dock item is
+/// anchored. While tracking, it watches the item and all its ancestors for
+/// move and resize, and reports a (coalesced) geometry change, so the popup
+/// is only repositioned when its arrow point can actually have moved.
+///
+class PopupAnchor : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit PopupAnchor(QWidget *item);
+
+    void track(const QPoint &point, const Dock::Position position);
+    void release();
+    bool update(const QPoint &point, const Dock::Position position);
+
+signals:
+    void geometryChanged() const;
+
+protected:
+    bool eventFilter(QObject *o, QEvent *e);
+
+private:
+    void watchAncestors();
+
+private:
+    QWidget *m_item;
+    QList<QPointer<QWidget>> m_watched;
+    QTimer *m_coalesceTimer;
+
+    QPoint m_point;
+    Dock::Position m_position;
+};
+
+#endif // POPUPANCHOR_H
@@ -55,28 +55,31 @@ PreviewContainer::PreviewContainer(QWidget *parent)
     connect(m_floatingPreview, &FloatingPreview::requestMove, this, &PreviewContainer::moveFloatingPreview);
 }
 
-void PreviewContainer::setWindowInfos(const WindowInfoMap &infos)
+void PreviewContainer::applyWindowInfoDelta(const WindowInfoMap &infos, const WindowInfoDelta &delta)
 {
-    // check removed window
-    for (auto it(m_snapshots.begin()); it != m_snapshots.end();)
+    for (const WId wid : delta.removed)
     {
-        if (!infos.contains(it.key()))
-        {
-            m_windowListLayout->removeWidget(it.value());
-            it.value()->deleteLater();
-            it = m_snapshots.erase(it);
-        } else {
-            ++it;
-        }
+        AppSnapshot *snap = m_snapshots.take(wid);
+        if (!snap)
+            continue;
+
+        m_windowListLayout->removeWidget(snap);
+        snap->deleteLater();
     }
 
-    for (auto it(infos.cbegin()); it != infos.cend(); ++it)
+    for (const WId wid : delta.added)
     {
-        if (!m_snapshots.contains(it.key()))
-            appendSnapWidget(it.key());
-        m_snapshots[it.key()]->setWindowInfo(it.value());
+        appendSnapWidget(wid);
+        m_snapshots[wid]->setWindowInfo(infos[wid]);
     }
 
+    for (auto it(delta.changed.cbegin()); it != delta.changed.cend(); ++it)
+        if (AppSnapshot *snap = m_snapshots.value(it.key()))
+            snap->setWindowInfo(infos[it.key()]);
+
+    if (!delta.countChanged())
+        return;
+
     if (m_snapshots.isEmpty())
         emit requestCancelAndHidePreview();
 
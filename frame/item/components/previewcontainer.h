@@ -29,6 +29,7 @@
 #include "constants.h"
 #include "appsnapshot.h"
 #include "floatingpreview.h"
+#include "windowinfodelta.h"
 
 #include <com_deepin_dde_daemon_dock_entry.h>
 
@@ -50,7 +51,7 @@ signals:
     void requestCancelAndHidePreview() const;
 
 public:
-    void setWindowInfos(const WindowInfoMap &infos);
+    void applyWindowInfoDelta(const WindowInfoMap &infos, const WindowInfoDelta &delta);
     void updateSnapshots();
 
 public slots:
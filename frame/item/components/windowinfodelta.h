@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WINDOWINFODELTA_H
+#define WINDOWINFODELTA_H
+
+#include <QMap>
+#include <QList>
+#include <QWidget>
+
+#include <com_deepin_dde_daemon_dock_entry.h>
+
+///
+/// \brief The WindowInfoDelta struct describes what changed between two
+/// WindowInfoMap values, so consumers only touch the affected windows.
+///
+struct WindowInfoDelta
+{
+    enum Field
+    {
+        Title       = 0x1,
+        Attention   = 0x2,
+    };
+
+    QList<WId> added;
+    QList<WId> removed;
+    // changed fields of windows present in both maps
+    QMap<WId, int> changed;
+
+    inline bool isEmpty() const { return added.isEmpty() && removed.isEmpty() && changed.isEmpty(); }
+    inline bool countChanged() const { return !added.isEmpty() || !removed.isEmpty(); }
+
+    static inline const WindowInfoDelta diff(const WindowInfoMap &from, const WindowInfoMap &to)
+    {
+        WindowInfoDelta delta;
+
+        for (auto it(from.cbegin()); it != from.cend(); ++it)
+            if (!to.contains(it.key()))
+                delta.removed << it.key();
+
+        for (auto it(to.cbegin()); it != to.cend(); ++it)
+        {
+            const auto old = from.constFind(it.key());
+            if (old == from.cend())
+            {
+                delta.added << it.key();
+                continue;
+            }
+
+            int fields = 0;
+            if (old.value().title != it.value().title)
+                fields |= Title;
+            if (old.value().attention != it.value().attention)
+                fields |= Attention;
+            if (fields)
+                delta.changed.insert(it.key(), fields);
+        }
+
+        return delta;
+    }
+};
+
+#endif // WINDOWINFODELTA_H
@@ -114,7 +114,7 @@ void ContainerItem::paintEvent(QPaintEvent *e)
         return;
 
     QPainter painter(this);
-    painter.drawPixmap(rect().center() - m_icon.rect().center() / m_icon.devicePixelRatioF(), m_icon);
+    drawIcon(painter, rect().center() - m_icon.rect().center() / m_icon.devicePixelRatioF(), m_icon);
 }
 
 void ContainerItem::mouseReleaseEvent(QMouseEvent *e)
@@ -23,25 +23,32 @@
 #include "dbus/dbusmenu.h"
 #include "dbus/dbusmenumanager.h"
 #include "components/hoverhighlighteffect.h"
+#include "util/imagefactory.h"
+#include "util/hotpathprofiler.h"
 
 #include <QMouseEvent>
+#include <QPainter>
 #include <QJsonObject>
+#include <QApplication>
+
+// context menu reply later than this is dropped, user has already moved on
+#define MENU_REGISTER_TIMEOUT   1000
 
 Position DockItem::DockPosition = Position::Top;
 DisplayMode DockItem::DockDisplayMode = DisplayMode::Efficient;
 QPointer<DockPopupWindow> DockItem::PopupWindow(nullptr);
+QPointer<DBusMenuManager> DockItem::MenuManagerInter(nullptr);
 
 DockItem::DockItem(QWidget *parent)
     : QWidget(parent),
       m_hover(false),
       m_popupShown(false),
 
-      m_hoverEffect(new HoverHighlightEffect(this)),
+      m_hoverEffect(nullptr),
+      m_hoverSourceKey(0),
 
       m_popupTipsDelayTimer(new QTimer(this)),
-      m_popupAdjustDelayTimer(new QTimer(this)),
-
-      m_menuManagerInter(new DBusMenuManager(this))
+      m_popupAnchor(new PopupAnchor(this))
 {
     if (PopupWindow.isNull())
     {
@@ -55,16 +62,17 @@ DockItem::DockItem(QWidget *parent)
         PopupWindow = arrowRectangle;
     }
 
+    if (MenuManagerInter.isNull())
+    {
+        MenuManagerInter = new DBusMenuManager(qApp);
+        MenuManagerInter->setTimeout(MENU_REGISTER_TIMEOUT);
+    }
+
     m_popupTipsDelayTimer->setInterval(500);
     m_popupTipsDelayTimer->setSingleShot(true);
 
-    m_popupAdjustDelayTimer->setInterval(10);
-    m_popupAdjustDelayTimer->setSingleShot(true);
-
-    setGraphicsEffect(m_hoverEffect);
-
     connect(m_popupTipsDelayTimer, &QTimer::timeout, this, &DockItem::showHoverTips);
-    connect(m_popupAdjustDelayTimer, &QTimer::timeout, this, &DockItem::updatePopupPosition, Qt::QueuedConnection);
+    connect(m_popupAnchor, &PopupAnchor::geometryChanged, this, &DockItem::updatePopupPosition);
 }
 
 DockItem::~DockItem()
@@ -83,34 +91,20 @@ void DockItem::setDockDisplayMode(const DisplayMode mode)
     DockDisplayMode = mode;
 }
 
-bool DockItem::event(QEvent *event)
-{
-    if (m_popupShown)
-    {
-        switch (event->type())
-        {
-        case QEvent::Paint:
-            if (!m_popupAdjustDelayTimer->isActive())
-                m_popupAdjustDelayTimer->start();
-            break;
-        default:;
-        }
-    }
-
-    return QWidget::event(event);
-}
-
 void DockItem::updatePopupPosition()
 {
-    Q_ASSERT(sender() == m_popupAdjustDelayTimer);
-
     if (!m_popupShown || !PopupWindow->model())
         return;
 
     if (PopupWindow->getContent() != m_lastPopupWidget.data())
         return popupWindowAccept();
 
+    // ancestors move and resize for many reasons, only follow if the arrow point changed
     const QPoint p = popupMarkPoint();
+    if (!m_popupAnchor->update(p, DockPosition))
+        return;
+
+    setPopupArrowDirection();
     PopupWindow->show(p, PopupWindow->model());
 }
 
@@ -131,7 +125,8 @@ void DockItem::mousePressEvent(QMouseEvent *e)
 void DockItem::enterEvent(QEvent *e)
 {
     m_hover = true;
-    m_hoverEffect->setHighlighting(true);
+    if (m_hoverEffect)
+        m_hoverEffect->setHighlighting(true);
     m_popupTipsDelayTimer->start();
 
     update();
@@ -144,7 +139,8 @@ void DockItem::leaveEvent(QEvent *e)
     QWidget::leaveEvent(e);
 
     m_hover = false;
-    m_hoverEffect->setHighlighting(false);
+    if (m_hoverEffect)
+        m_hoverEffect->setHighlighting(false);
     m_popupTipsDelayTimer->stop();
 
     // auto hide if popup is not model window
@@ -169,13 +165,29 @@ const QRect DockItem::perfectIconRect() const
 
 void DockItem::showContextMenu()
 {
+    // last request is still in progress
+    if (!m_pendingMenuJson.isEmpty())
+        return;
+
     const QString menuJson = contextMenu();
     if (menuJson.isEmpty())
         return;
 
-    QDBusPendingReply<QDBusObjectPath> result = m_menuManagerInter->RegisterMenu();
+    m_pendingMenuJson = menuJson;
+    m_contextMenuLatency.start();
+
+    QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(MenuManagerInter->RegisterMenu(), this);
+    connect(watcher, &QDBusPendingCallWatcher::finished, this, &DockItem::onMenuRegistered);
+}
 
-    result.waitForFinished();
+void DockItem::onMenuRegistered(QDBusPendingCallWatcher *w)
+{
+    w->deleteLater();
+
+    const QString menuJson = m_pendingMenuJson;
+    m_pendingMenuJson.clear();
+
+    QDBusPendingReply<QDBusObjectPath> result = *w;
     if (result.isError())
     {
         qWarning() << result.error();
@@ -209,6 +221,46 @@ void DockItem::showContextMenu()
 
     hidePopup();
     emit requestWindowAutoHide(false);
+
+    if (HotPathProfiler::enabled())
+        HotPathProfiler::record("DockItem::contextMenuLatency", m_contextMenuLatency.nsecsElapsed());
+}
+
+///
+/// \brief DockItem::drawIcon draw an item icon, lightened while hovered.
+/// the lightened copy is cached until the icon pixmap changes.
+///
+void DockItem::drawIcon(QPainter &painter, const QPoint &pos, const QPixmap &pixmap)
+{
+    if (!m_hover || pixmap.isNull())
+        return painter.drawPixmap(pos, pixmap);
+
+    if (m_hoverSourceKey != pixmap.cacheKey())
+    {
+        m_hoverSourceKey = pixmap.cacheKey();
+        m_hoverPixmap = ImageFactory::lighterEffect(pixmap);
+        m_hoverPixmap.setDevicePixelRatio(pixmap.devicePixelRatioF());
+    }
+
+    painter.drawPixmap(pos, m_hoverPixmap);
+}
+
+///
+/// \brief DockItem::setHoverEffectEnabled highlight the whole rendered widget
+/// through a graphics effect, for content the item can not paint itself.
+///
+void DockItem::setHoverEffectEnabled(const bool enabled)
+{
+    if (enabled == !m_hoverEffect.isNull())
+        return;
+
+    if (!enabled)
+        return setGraphicsEffect(nullptr);
+
+    m_hoverEffect = new HoverHighlightEffect(this);
+    m_hoverEffect->setHighlighting(m_hover);
+
+    setGraphicsEffect(m_hoverEffect);
 }
 
 void DockItem::onContextMenuAccepted()
@@ -248,17 +300,12 @@ void DockItem::showPopupWindow(QWidget * const content, const bool model)
     if (lastContent)
         lastContent->setVisible(false);
 
-    switch (DockPosition)
-    {
-    case Top:   popup->setArrowDirection(DockPopupWindow::ArrowTop);     break;
-    case Bottom:popup->setArrowDirection(DockPopupWindow::ArrowBottom);  break;
-    case Left:  popup->setArrowDirection(DockPopupWindow::ArrowLeft);    break;
-    case Right: popup->setArrowDirection(DockPopupWindow::ArrowRight);   break;
-    }
+    setPopupArrowDirection();
     popup->resize(content->sizeHint());
     popup->setContent(content);
 
     const QPoint p = popupMarkPoint();
+    m_popupAnchor->track(p, DockPosition);
     if (!popup->isVisible())
         QMetaObject::invokeMethod(popup, "show", Qt::QueuedConnection, Q_ARG(QPoint, p), Q_ARG(bool, model));
     else
@@ -267,6 +314,19 @@ void DockItem::showPopupWindow(QWidget * const content, const bool model)
     connect(popup, &DockPopupWindow::accept, this, &DockItem::popupWindowAccept, Qt::UniqueConnection);
 }
 
+void DockItem::setPopupArrowDirection()
+{
+    DockPopupWindow *popup = PopupWindow.data();
+
+    switch (DockPosition)
+    {
+    case Top:   popup->setArrowDirection(DockPopupWindow::ArrowTop);     break;
+    case Bottom:popup->setArrowDirection(DockPopupWindow::ArrowBottom);  break;
+    case Left:  popup->setArrowDirection(DockPopupWindow::ArrowLeft);    break;
+    case Right: popup->setArrowDirection(DockPopupWindow::ArrowRight);   break;
+    }
+}
+
 void DockItem::popupWindowAccept()
 {
     if (!PopupWindow->isVisible())
@@ -334,7 +394,7 @@ const QPoint DockItem::topleftPoint() const
 void DockItem::hidePopup()
 {
     m_popupTipsDelayTimer->stop();
-    m_popupAdjustDelayTimer->stop();
+    m_popupAnchor->release();
     m_popupShown = false;
     PopupWindow->hide();
 
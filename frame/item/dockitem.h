@@ -25,14 +25,19 @@
 #include "constants.h"
 #include "util/dockpopupwindow.h"
 #include "components/hoverhighlighteffect.h"
+#include "components/popupanchor.h"
 
 #include <QFrame>
 #include <QPointer>
+#include <QPixmap>
+#include <QElapsedTimer>
+#include <QDBusPendingCallWatcher>
 
 #include <memory>
 
 using namespace Dock;
 
+class QPainter;
 class DBusMenuManager;
 class DockItem : public QWidget
 {
@@ -67,13 +72,14 @@ signals:
     void requestRefershWindowVisible() const;
 
 protected:
-    bool event(QEvent *event);
     void paintEvent(QPaintEvent *e);
     void mousePressEvent(QMouseEvent *e);
     void enterEvent(QEvent *e);
     void leaveEvent(QEvent *e);
 
     const QRect perfectIconRect() const;
+    void drawIcon(QPainter &painter, const QPoint &pos, const QPixmap &pixmap);
+    void setHoverEffectEnabled(const bool enabled);
     const QPoint popupMarkPoint() const;
     const QPoint topleftPoint() const;
 
@@ -91,24 +97,32 @@ protected slots:
     void showContextMenu();
     void onContextMenuAccepted();
 
-private:
+private slots:
+    void onMenuRegistered(QDBusPendingCallWatcher *w);
     void updatePopupPosition();
 
+private:
+    void setPopupArrowDirection();
+
 protected:
     bool m_hover;
     bool m_popupShown;
 
     QPointer<QWidget> m_lastPopupWidget;
     QPointer<HoverHighlightEffect> m_hoverEffect;
+    qint64 m_hoverSourceKey;
+    QPixmap m_hoverPixmap;
 
     QTimer *m_popupTipsDelayTimer;
-    QTimer *m_popupAdjustDelayTimer;
+    PopupAnchor *m_popupAnchor;
 
-    DBusMenuManager *m_menuManagerInter;
+    QString m_pendingMenuJson;
+    QElapsedTimer m_contextMenuLatency;
 
     static Position DockPosition;
     static DisplayMode DockDisplayMode;
     static QPointer<DockPopupWindow> PopupWindow;
+    static QPointer<DBusMenuManager> MenuManagerInter;
 };
 
 #endif // DOCKITEM_H
@@ -73,7 +73,7 @@ void LauncherItem::paintEvent(QPaintEvent *e)
     const int iconX = rect().center().x() - pixmap.rect().center().x() / ratio;
     const int iconY = rect().center().y() - pixmap.rect().center().y() / ratio;
 
-    painter.drawPixmap(iconX, iconY, pixmap);
+    drawIcon(painter, QPoint(iconX, iconY), pixmap);
 }
 
 void LauncherItem::resizeEvent(QResizeEvent *e)
@@ -24,6 +24,7 @@
 #include "pluginsiteminterface.h"
 
 #include "util/imagefactory.h"
+#include "util/commanddispatcher.h"
 
 #include <QPainter>
 #include <QBoxLayout>
@@ -56,6 +57,10 @@ PluginsItem::PluginsItem(PluginsItemInterface* const pluginInter, const QString
     setLayout(hLayout);
     setAccessibleName(pluginInter->pluginName() + "-" + m_itemKey);
     setAttribute(Qt::WA_TranslucentBackground);
+
+    // plugin widgets paint themselves, the effect renders them offscreen on every paint,
+    // so only items whose plugin asks for it get highlighted
+    setHoverEffectEnabled(hoverEffectRequested());
 }
 
 PluginsItem::~PluginsItem()
@@ -210,19 +215,44 @@ void PluginsItem::startDrag()
 
 void PluginsItem::mouseClicked()
 {
+    const PluginCommand descriptor = commandDescriptor();
+    if (descriptor.isValid())
+        return CommandDispatcher::instance()->dispatch(descriptor);
+
     const QString command = m_pluginInter->itemCommand(m_itemKey);
     if (!command.isEmpty())
-    {
-        QProcess *proc = new QProcess(this);
-
-        connect(proc, static_cast<void (QProcess::*)(int)>(&QProcess::finished), proc, &QProcess::deleteLater);
-
-        proc->startDetached(command);
-        return;
-    }
+        return CommandDispatcher::instance()->dispatch(command);
 
     // request popup applet
     QWidget *w = m_pluginInter->itemPopupApplet(m_itemKey);
     if (w)
         showPopupApplet(w);
 }
+
+bool PluginsItem::hoverEffectRequested() const
+{
+    // optional invokable on the plugin object, see PluginsItemInterface::itemWidget
+    QObject *plugin = dynamic_cast<QObject *>(m_pluginInter);
+    if (!plugin || plugin->metaObject()->indexOfMethod("itemHoverEffect(QString)") == -1)
+        return false;
+
+    bool requested = false;
+    QMetaObject::invokeMethod(plugin, "itemHoverEffect", Qt::DirectConnection,
+                              Q_RETURN_ARG(bool, requested), Q_ARG(QString, m_itemKey));
+
+    return requested;
+}
+
+const PluginCommand PluginsItem::commandDescriptor() const
+{
+    // optional invokable on the plugin object, see PluginsItemInterface::itemCommand
+    QObject *plugin = dynamic_cast<QObject *>(m_pluginInter);
+    if (!plugin || plugin->metaObject()->indexOfMethod("itemCommandDescriptor(QString)") == -1)
+        return PluginCommand();
+
+    QVariantMap descriptor;
+    QMetaObject::invokeMethod(plugin, "itemCommandDescriptor", Qt::DirectConnection,
+                              Q_RETURN_ARG(QVariantMap, descriptor), Q_ARG(QString, m_itemKey));
+
+    return PluginCommand::fromDescriptor(descriptor);
+}
@@ -24,6 +24,7 @@
 
 #include "dockitem.h"
 #include "pluginsiteminterface.h"
+#include "util/commanddispatcher.h"
 
 class PluginsItem : public DockItem
 {
@@ -64,6 +65,8 @@ private:
 private:
     void startDrag();
     void mouseClicked();
+    bool hoverEffectRequested() const;
+    const PluginCommand commandDescriptor() const;
 
 private:
     PluginsItemInterface * const m_pluginInter;
@@ -21,6 +21,10 @@
 
 #include "window/mainwindow.h"
 #include "util/themeappicon.h"
+#include "util/hotpathprofiler.h"
+#include "util/eventlooptracer.h"
+#include "util/startupprofiler.h"
+#include "xcb/xcb_timestamp.h"
 
 #include <DApplication>
 #include <DLog>
@@ -61,6 +65,8 @@ void RegisterDdeSession()
 
 int main(int argc, char *argv[])
 {
+    StartupProfiler::instance();
+
     DApplication::loadDXcbPlugin();
     DApplication app(argc, argv);
     if (!app.setSingleInstance(QString("dde-dock_%1").arg(getuid()))) {
@@ -82,6 +88,9 @@ int main(int argc, char *argv[])
     qDebug() << "\n\ndde-dock startup";
     RegisterDdeSession();
 
+    // start tracking input timestamps before the first click
+    XcbTimestamp::instance();
+
 #ifndef QT_DEBUG
     QDir::setCurrent(QApplication::applicationDirPath());
 #endif
@@ -90,8 +99,19 @@ int main(int argc, char *argv[])
     DBusDockAdaptors adaptor(&mw);
     QDBusConnection::sessionBus().registerService("com.deepin.dde.Dock");
     QDBusConnection::sessionBus().registerObject("/com/deepin/dde/Dock", "com.deepin.dde.Dock", &mw);
+    StartupProfiler::instance()->mark(StartupProfiler::DBusReady);
 
     QTimer::singleShot(1, &mw, &MainWindow::launch);
 
+    if (HotPathProfiler::enabled())
+        QObject::connect(&app, &QApplication::aboutToQuit, &HotPathProfiler::dump);
+
+    const QString tracePath = QString::fromLocal8Bit(qgetenv("DDE_DOCK_TRACE"));
+    if (!tracePath.isEmpty())
+    {
+        EventLoopTracer::instance()->setEnabled(true);
+        QObject::connect(&app, &QApplication::aboutToQuit, [=] { EventLoopTracer::instance()->writeTrace(tracePath); });
+    }
+
     return app.exec();
 }
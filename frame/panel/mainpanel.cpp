@@ -20,6 +20,7 @@
  */
 
 #include "mainpanel.h"
+#include "util/hotpathprofiler.h"
 #include "item/appitem.h"
 
 #include <QBoxLayout>
@@ -169,21 +170,12 @@ void MainPanel::setEffectEnabled(const bool enabled)
     m_itemAdjustTimer->start();
 }
 
-void MainPanel::moveEvent(QMoveEvent* e)
-{
-    DBlurEffectWidget::moveEvent(e);
-
-    QTimer::singleShot(500, this, &MainPanel::geometryChanged);
-}
-
 void MainPanel::resizeEvent(QResizeEvent *e)
 {
     DBlurEffectWidget::resizeEvent(e);
 
     m_itemAdjustTimer->start();
 //    m_effectWidget->resize(e->size());
-
-    QTimer::singleShot(500, this, &MainPanel::geometryChanged);
 }
 
 void MainPanel::dragEnterEvent(QDragEnterEvent *e)
@@ -307,6 +299,8 @@ void MainPanel::manageItem(DockItem *item)
 ///
 DockItem *MainPanel::itemAt(const QPoint &point)
 {
+    PROFILE_HOT_PATH("MainPanel::itemAt");
+
     const auto &itemList = m_itemController->itemList();
 
     for (auto item : itemList)
@@ -332,6 +326,8 @@ DockItem *MainPanel::itemAt(const QPoint &point)
 ///
 void MainPanel::adjustItemSize()
 {
+    PROFILE_HOT_PATH("MainPanel::adjustItemSize");
+
     Q_ASSERT(sender() == m_itemAdjustTimer);
 
     // ensure all item is update, whatever layout is changed
@@ -550,6 +546,7 @@ void MainPanel::itemMoved(DockItem *item, const int index)
 void MainPanel::itemDragStarted()
 {
     DraggingItem = qobject_cast<DockItem *>(sender());
+    m_itemController->beginDragSession(DraggingItem);
 
     if (DraggingItem->itemType() == DockItem::Plugins)
     {
@@ -575,13 +572,16 @@ void MainPanel::itemDropped(QObject *destnation)
 {
     m_itemController->setDropping(false);
 
+    // commit the order changed while dragging, or roll back if dropped outside
+    m_itemController->finishDragSession(destnation != nullptr);
+
     if (m_displayMode == Dock::Fashion)
         return;
 
     DockItem *src = qobject_cast<DockItem *>(sender());
 //    DockItem *dst = qobject_cast<DockItem *>(destnation);
 
-    if (!src)
+    if (!src || src->itemType() != DockItem::Plugins)
         return;
 
     const bool itemIsInContainer = m_itemController->itemIsInContainer(src);
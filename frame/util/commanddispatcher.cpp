@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "commanddispatcher.h"
+#include "hotpathprofiler.h"
+
+#include <QProcess>
+#include <QCoreApplication>
+#include <QDBusConnection>
+#include <QDBusObjectPath>
+#include <QDebug>
+
+CommandDispatcher *CommandDispatcher::instance()
+{
+    static CommandDispatcher *INSTANCE = new CommandDispatcher(qApp);
+
+    return INSTANCE;
+}
+
+CommandDispatcher::CommandDispatcher(QObject *parent)
+    : QObject(parent)
+{
+}
+
+void CommandDispatcher::dispatch(const PluginCommand &command)
+{
+    PROFILE_HOT_PATH("CommandDispatcher::dispatch");
+
+    QDBusMessage msg = QDBusMessage::createMethodCall(command.service, command.path, command.interface, command.method);
+    msg.setArguments(command.arguments);
+
+    QDBusConnection::sessionBus().asyncCall(msg);
+}
+
+void CommandDispatcher::dispatch(const QString &command)
+{
+    PROFILE_HOT_PATH("CommandDispatcher::dispatch");
+
+    const QStringList args = splitCommand(command);
+
+    QDBusMessage msg;
+    bool systemBus = false;
+    if (!args.isEmpty() && args.first() == "dbus-send" && parseDBusSend(args, msg, systemBus))
+    {
+        QDBusConnection bus = systemBus ? QDBusConnection::systemBus() : QDBusConnection::sessionBus();
+        bus.asyncCall(msg);
+        return;
+    }
+
+    QProcess::startDetached(command);
+}
+
+// split like a shell does for plain words and quoted strings,
+// no variables, globs or escapes inside single quotes
+const QStringList CommandDispatcher::splitCommand(const QString &command)
+{
+    QStringList args;
+    QString current;
+    bool inToken = false;
+    QChar quote;
+
+    for (int i(0); i != command.size(); ++i)
+    {
+        const QChar c = command[i];
+
+        if (!quote.isNull())
+        {
+            if (c == quote)
+                quote = QChar();
+            else if (c == '\\' && quote == '"' && i + 1 != command.size())
+                current.append(command[++i]);
+            else
+                current.append(c);
+            continue;
+        }
+
+        if (c == '"' || c == '\'')
+        {
+            quote = c;
+            inToken = true;
+        } else if (c.isSpace()) {
+            if (inToken)
+                args << current;
+            current.clear();
+            inToken = false;
+        } else if (c == '\\' && i + 1 != command.size()) {
+            current.append(command[++i]);
+            inToken = true;
+        } else {
+            current.append(c);
+            inToken = true;
+        }
+    }
+
+    if (inToken)
+        args << current;
+
+    return args;
+}
+
+// dbus-send [--system|--session] [--dest=NAME] [--print-reply[=literal]]
+//           [--reply-timeout=MSEC] [--type=method_call] PATH INTERFACE.MEMBER [TYPE:VALUE ...]
+bool CommandDispatcher::parseDBusSend(const QStringList &args, QDBusMessage &msg, bool &systemBus)
+{
+    QString dest;
+    int i = 1;
+    for (; i != args.size() && args[i].startsWith("--"); ++i)
+    {
+        const QString &opt = args[i];
+
+        if (opt == "--system")
+            systemBus = true;
+        else if (opt == "--session")
+            systemBus = false;
+        else if (opt.startsWith("--dest="))
+            dest = opt.mid(7);
+        else if (opt == "--type=signal")
+            return false;
+        else if (!opt.startsWith("--print-reply") && !opt.startsWith("--reply-timeout=") && !opt.startsWith("--type="))
+            return false;
+    }
+
+    // path and member are required, signals without dest are not supported
+    if (dest.isEmpty() || args.size() - i < 2)
+        return false;
+
+    const QString &path = args[i];
+    const QString &member = args[i + 1];
+    const int dot = member.lastIndexOf('.');
+    if (dot <= 0)
+        return false;
+
+    QVariantList arguments;
+    for (int j(i + 2); j != args.size(); ++j)
+    {
+        QVariant value;
+        if (!parseArgument(args[j], value))
+            return false;
+        arguments << value;
+    }
+
+    msg = QDBusMessage::createMethodCall(dest, path, member.left(dot), member.mid(dot + 1));
+    msg.setArguments(arguments);
+
+    return true;
+}
+
+bool CommandDispatcher::parseArgument(const QString &arg, QVariant &value)
+{
+    const int colon = arg.indexOf(':');
+    if (colon <= 0)
+        return false;
+
+    const QString type = arg.left(colon);
+    const QString v = arg.mid(colon + 1);
+    bool ok = true;
+
+    if (type == "string")
+        value = v;
+    else if (type == "objpath")
+        value = QVariant::fromValue(QDBusObjectPath(v));
+    else if (type == "boolean")
+        value = v == "true";
+    else if (type == "byte")
+        value = QVariant::fromValue(uchar(v.toUShort(&ok)));
+    else if (type == "int16")
+        value = QVariant::fromValue(v.toShort(&ok));
+    else if (type == "uint16")
+        value = QVariant::fromValue(v.toUShort(&ok));
+    else if (type == "int32")
+        value = v.toInt(&ok);
+    else if (type == "uint32")
+        value = v.toUInt(&ok);
+    else if (type == "int64")
+        value = v.toLongLong(&ok);
+    else if (type == "uint64")
+        value = v.toULongLong(&ok);
+    else if (type == "double")
+        value = v.toDouble(&ok);
+    else
+        // containers and variants are left to the real dbus-send
+        return false;
+
+    return ok;
+}
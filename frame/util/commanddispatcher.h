@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef COMMANDDISPATCHER_H
+#define COMMANDDISPATCHER_H
+
+#include <QObject>
+#include <QVariantMap>
+#include <QDBusMessage>
+
+///
+/// \brief The PluginCommand struct
+/// structured form of a D-Bus method call on the session bus, dock sends it
+/// directly without parsing a command line or starting a process.
+///
+struct PluginCommand
+{
+    QString service;
+    QString path;
+    QString interface;
+    QString method;
+    QVariantList arguments;
+
+    inline bool isValid() const { return !service.isEmpty() && !path.isEmpty() && !method.isEmpty(); }
+
+    static const PluginCommand fromDescriptor(const QVariantMap &descriptor)
+    {
+        return PluginCommand { descriptor.value("service").toString(),
+                               descriptor.value("path").toString(),
+                               descriptor.value("interface").toString(),
+                               descriptor.value("method").toString(),
+                               descriptor.value("arguments").toList() };
+    }
+};
+
+///
+/// \brief The CommandDispatcher class runs plugin item commands. dbus-send
+/// command lines are sent as asynchronous D-Bus calls from the dock process,
+/// anything else is started as a detached process.
+///
+class CommandDispatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    static CommandDispatcher *instance();
+
+    void dispatch(const PluginCommand &command);
+    void dispatch(const QString &command);
+
+private:
+    explicit CommandDispatcher(QObject *parent = nullptr);
+
+    static const QStringList splitCommand(const QString &command);
+    static bool parseDBusSend(const QStringList &args, QDBusMessage &msg, bool &systemBus);
+    static bool parseArgument(const QString &arg, QVariant &value);
+};
+
+#endif // COMMANDDISPATCHER_H
@@ -30,11 +30,11 @@ DWIDGET_USE_NAMESPACE
 DockPopupWindow::DockPopupWindow(QWidget *parent)
     : DArrowRectangle(ArrowBottom, parent),
       m_model(false),
+      m_relayoutPending(false),
 
       m_acceptDelayTimer(new QTimer(this)),
 
-      m_regionInter(new DRegionMonitor(this)),
-      m_displayInter(new DBusDisplay(this))
+      m_regionInter(new DRegionMonitor(this))
 {
     m_acceptDelayTimer->setSingleShot(true);
     m_acceptDelayTimer->setInterval(100);
@@ -93,6 +93,9 @@ void DockPopupWindow::show(const int x, const int y)
     m_lastPoint = QPoint(x, y);
 
     DArrowRectangle::show(x, y);
+
+    QWidget *content = getContent();
+    m_lastContentSize = content ? content->size() : QSize();
 }
 
 void DockPopupWindow::hide()
@@ -123,18 +126,31 @@ bool DockPopupWindow::eventFilter(QObject *o, QEvent *e)
         return false;
 
     // FIXME: ensure position move after global mouse release event
-    if (isVisible())
+    // several resizes in a row are applied with a single re-show
+    if (isVisible() && !m_relayoutPending)
     {
-        QTimer::singleShot(10, this, [=] {
-            // NOTE(sbw): double check is necessary, in this time, the popup maybe already hided.
-            if (isVisible())
-                show(m_lastPoint, m_model);
-        });
+        m_relayoutPending = true;
+        QMetaObject::invokeMethod(this, "relayout", Qt::QueuedConnection);
     }
 
     return false;
 }
 
+void DockPopupWindow::relayout()
+{
+    m_relayoutPending = false;
+
+    // NOTE(sbw): double check is necessary, in this time, the popup maybe already hided.
+    if (!isVisible())
+        return;
+
+    QWidget *content = getContent();
+    if (content && content->size() == m_lastContentSize)
+        return;
+
+    show(m_lastPoint, m_model);
+}
+
 void DockPopupWindow::onGlobMouseRelease(const QPoint &mousePos, const int flag)
 {
     Q_UNUSED(flag);
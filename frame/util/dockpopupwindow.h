@@ -59,15 +59,17 @@ private slots:
     void onGlobMouseRelease(const QPoint &mousePos, const int flag);
     void compositeChanged();
     void ensureRaised();
+    void relayout();
 
 private:
     bool m_model;
+    bool m_relayoutPending;
     QPoint m_lastPoint;
+    QSize m_lastContentSize;
 
     QTimer *m_acceptDelayTimer;
 
     DRegionMonitor *m_regionInter;
-    DBusDisplay *m_displayInter;
     DWindowManagerHelper *m_wmHelper;
 };
 
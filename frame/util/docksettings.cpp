@@ -22,6 +22,7 @@
 #include "docksettings.h"
 #include "panel/mainpanel.h"
 #include "item/appitem.h"
+#include "util/screentopology.h"
 
 #include <QDebug>
 #include <QX11Info>
@@ -36,7 +37,21 @@
 
 DWIDGET_USE_NAMESPACE
 
-extern const QPoint rawXPosition(const QPoint &scaledPos);
+bool WindowConfig::operator==(const WindowConfig &other) const
+{
+    return displayMode == other.displayMode &&
+           position == other.position &&
+           visibleItemCount == other.visibleItemCount &&
+           itemWidth == other.itemWidth &&
+           itemHeight == other.itemHeight &&
+           primarySize == other.primarySize;
+}
+
+uint qHash(const WindowConfig &config, uint seed)
+{
+    return qHash(qMakePair(int(config.displayMode) << 8 | int(config.position), config.visibleItemCount), seed) ^
+           qHash(qMakePair(config.itemWidth << 16 | config.itemHeight, config.primarySize.width() << 16 | config.primarySize.height()), seed);
+}
 
 DockSettings::DockSettings(QWidget *parent)
     : QObject(parent),
@@ -56,9 +71,10 @@ DockSettings::DockSettings(QWidget *parent)
       m_keepHiddenAct(tr("Keep Hidden"), this),
       m_smartHideAct(tr("Smart Hide"), this),
 
-      m_displayInter(new DBusDisplay(this)),
-      m_dockInter(new DBusDock(this)),
-      m_itemController(DockItemController::instance(this))
+      m_displayInter(DBusDisplay::instance()),
+      m_dockInter(DBusDock::instance()),
+      m_itemController(DockItemController::instance(this)),
+      m_frontendNotifier(new GeometryNotifier(0, this))
 {
     m_primaryRect = m_displayInter->primaryRect();
     m_primaryRawRect = m_displayInter->primaryRawRect();
@@ -133,8 +149,15 @@ DockSettings::DockSettings(QWidget *parent)
     connect(m_dockInter, &DBusDock::DisplayModeChanged, this, &DockSettings::onDisplayModeChanged);
     connect(m_dockInter, &DBusDock::HideModeChanged, this, &DockSettings::hideModeChanged, Qt::QueuedConnection);
     connect(m_dockInter, &DBusDock::HideStateChanged, this, &DockSettings::hideStateChanged);
-    connect(m_dockInter, &DBusDock::ServiceRestarted, this, &DockSettings::resetFrontendGeometry);
+    connect(m_dockInter, &DBusDock::ServiceRestarted, this, &DockSettings::dockServiceRestarted);
+    connect(m_frontendNotifier, &GeometryNotifier::geometrySettled, this, &DockSettings::frontendGeometrySettled);
+
+    // walked once here, the controller signals keep the counts after that
+    for (auto item : m_itemController->itemList())
+        ++m_itemTypeCount[item->itemType()];
 
+    connect(m_itemController, &DockItemController::itemInserted, this, &DockSettings::dockItemInserted);
+    connect(m_itemController, &DockItemController::itemRemoved, this, &DockSettings::dockItemRemoved);
     connect(m_itemController, &DockItemController::itemInserted, this, &DockSettings::dockItemCountChanged, Qt::QueuedConnection);
     connect(m_itemController, &DockItemController::itemRemoved, this, &DockSettings::dockItemCountChanged, Qt::QueuedConnection);
 
@@ -391,6 +414,18 @@ void DockSettings::dockItemCountChanged()
     emit windowGeometryChanged();
 }
 
+void DockSettings::dockItemInserted(const int index, DockItem *item)
+{
+    Q_UNUSED(index);
+
+    ++m_itemTypeCount[item->itemType()];
+}
+
+void DockSettings::dockItemRemoved(DockItem *item)
+{
+    --m_itemTypeCount[item->itemType()];
+}
+
 void DockSettings::primaryScreenChanged()
 {
 //    qDebug() << Q_FUNC_INFO;
@@ -409,12 +444,26 @@ void DockSettings::resetFrontendGeometry()
 {
     const QRect r = windowRect(m_position);
     const qreal ratio = qApp->devicePixelRatio();
-    const QPoint p = rawXPosition(r.topLeft());
+    const QPoint p = ScreenTopology::instance()->rawXPosition(r.topLeft());
     const uint w = r.width() * ratio;
     const uint h = r.height() * ratio;
 
     m_frontendRect = QRect(p.x(), p.y(), w, h);
-    m_dockInter->SetFrontendWindowRect(p.x(), p.y(), w, h);
+    // calculateWindowConfig runs several times per change, only the settled rect is sent
+    m_frontendNotifier->update(m_frontendRect);
+}
+
+void DockSettings::dockServiceRestarted()
+{
+    // the new daemon instance knows nothing about us, publish again
+    m_frontendNotifier->reset();
+
+    resetFrontendGeometry();
+}
+
+void DockSettings::frontendGeometrySettled(const QRect &rect)
+{
+    m_dockInter->SetFrontendWindowRect(rect.x(), rect.y(), rect.width(), rect.height());
 }
 
 bool DockSettings::test(const Position pos, const QList<QRect> &otherScreens) const
@@ -459,21 +508,19 @@ void DockSettings::updateForbidPostions()
 {
     qDebug() << Q_FUNC_INFO;
 
-    const auto &screens = qApp->screens();
+    const ScreenTopology *topology = ScreenTopology::instance();
+    const auto &screens = topology->screens();
     if (screens.size() < 2)
         return m_forbidPositions.clear();
 
     QSet<Position> forbids;
     QList<QRect> rawScreenRects;
-    for (auto *s : screens)
+    for (int i(0); i != screens.size(); ++i)
     {
-        qInfo() << s->name() << s->geometry();
-
-        if (s == qApp->primaryScreen())
+        if (i == topology->primaryIndex())
             continue;
 
-        const QRect &g = s->geometry();
-        rawScreenRects << QRect(g.topLeft(), g.size() * s->devicePixelRatio());
+        rawScreenRects << screens[i].native;
     }
 
     qInfo() << rawScreenRects << m_screenRawWidth << m_screenRawHeight;
@@ -490,66 +537,95 @@ void DockSettings::updateForbidPostions()
     m_forbidPositions = std::move(forbids);
 }
 
+int DockSettings::visibleItemCount() const
+{
+    return m_itemTypeCount.value(DockItem::Launcher) +
+           m_itemTypeCount.value(DockItem::App) +
+           m_itemTypeCount.value(DockItem::Plugins) +
+           m_itemTypeCount.value(DockItem::Placeholder);
+}
+
 void DockSettings::calculateWindowConfig()
 {
     const auto ratio = qApp->devicePixelRatio();
-    const int defaultHeight = std::round(AppItem::itemBaseHeight() / ratio);
-    const int defaultWidth = std::round(AppItem::itemBaseWidth() / ratio);
 
-    if (m_displayMode == Dock::Efficient)
+    WindowConfig config;
+    config.displayMode = m_displayMode;
+    config.position = m_position;
+    config.visibleItemCount = 0;
+    config.itemWidth = std::round(AppItem::itemBaseWidth() / ratio);
+    config.itemHeight = std::round(AppItem::itemBaseHeight() / ratio);
+    config.primarySize = m_primaryRect.size();
+
+    // efficient mode always fills the screen edge, item count does not matter
+    if (m_displayMode == Dock::Fashion)
+        config.visibleItemCount = visibleItemCount();
+
+    auto it = m_windowSizeCache.constFind(config);
+    if (it == m_windowSizeCache.constEnd())
     {
-        switch (m_position)
+        // keys only vary with item count in practice, keep the cache bounded anyway
+        if (m_windowSizeCache.size() >= 64)
+            m_windowSizeCache.clear();
+
+        it = m_windowSizeCache.insert(config, calculateWindowSize(config));
+    }
+
+    m_mainWindowSize = it.value();
+
+    resetFrontendGeometry();
+}
+
+///
+/// \brief DockSettings::calculateWindowSize main window size for the given
+/// config, a pure function so results can be cached by config.
+///
+const QSize DockSettings::calculateWindowSize(const WindowConfig &config)
+{
+    const int defaultHeight = config.itemHeight;
+    const int defaultWidth = config.itemWidth;
+
+    QSize size;
+
+    if (config.displayMode == Dock::Efficient)
+    {
+        switch (config.position)
         {
         case Top:
         case Bottom:
-            m_mainWindowSize.setHeight(defaultHeight + PANEL_BORDER + WINDOW_OVERFLOW);
-            m_mainWindowSize.setWidth(m_primaryRect.width());
+            size.setHeight(defaultHeight + PANEL_BORDER + WINDOW_OVERFLOW);
+            size.setWidth(config.primarySize.width());
             break;
 
         case Left:
         case Right:
-            m_mainWindowSize.setHeight(m_primaryRect.height());
-            m_mainWindowSize.setWidth(defaultWidth + PANEL_BORDER + WINDOW_OVERFLOW);
+            size.setHeight(config.primarySize.height());
+            size.setWidth(defaultWidth + PANEL_BORDER + WINDOW_OVERFLOW);
             break;
 
         default:
             Q_ASSERT(false);
         }
     }
-    else if (m_displayMode == Dock::Fashion)
+    else if (config.displayMode == Dock::Fashion)
     {
-        int visibleItemCount = 0;
-        const auto &itemList = m_itemController->itemList();
-        for (auto item : itemList)
-        {
-            switch (item->itemType())
-            {
-            case DockItem::Launcher:
-            case DockItem::App:
-            case DockItem::Plugins:
-            case DockItem::Placeholder:
-                ++visibleItemCount;
-                break;
-            default:;
-            }
-        }
-
+        const int visibleItemCount = config.visibleItemCount;
         const int perfectWidth = visibleItemCount * defaultWidth + PANEL_BORDER * 2 + PANEL_PADDING * 2 + PANEL_MARGIN * 2;
         const int perfectHeight = visibleItemCount * defaultHeight + PANEL_BORDER * 2 + PANEL_PADDING * 2 + PANEL_MARGIN * 2;
-        const int calcWidth = qMin(m_primaryRect.width() - FASHION_MODE_PADDING * 2, perfectWidth);
-        const int calcHeight = qMin(m_primaryRect.height() - FASHION_MODE_PADDING * 2, perfectHeight);
-        switch (m_position)
+        const int calcWidth = qMin(config.primarySize.width() - FASHION_MODE_PADDING * 2, perfectWidth);
+        const int calcHeight = qMin(config.primarySize.height() - FASHION_MODE_PADDING * 2, perfectHeight);
+        switch (config.position)
         {
         case Top:
         case Bottom:
-            m_mainWindowSize.setHeight(defaultHeight + PANEL_BORDER);
-            m_mainWindowSize.setWidth(calcWidth);
+            size.setHeight(defaultHeight + PANEL_BORDER);
+            size.setWidth(calcWidth);
             break;
 
         case Left:
         case Right:
-            m_mainWindowSize.setHeight(calcHeight);
-            m_mainWindowSize.setWidth(defaultWidth + PANEL_BORDER);
+            size.setHeight(calcHeight);
+            size.setWidth(defaultWidth + PANEL_BORDER);
             break;
 
         default:
@@ -559,7 +635,7 @@ void DockSettings::calculateWindowConfig()
         Q_ASSERT(false);
     }
 
-    resetFrontendGeometry();
+    return size;
 }
 
 void DockSettings::gtkIconThemeChanged()
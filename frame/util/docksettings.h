@@ -27,12 +27,14 @@
 #include "dbus/dbusmenumanager.h"
 #include "dbus/dbusdisplay.h"
 #include "controller/dockitemcontroller.h"
+#include "util/geometrynotifier.h"
 
 #include <QAction>
 #include <QMenu>
 
 #include <QObject>
 #include <QSize>
+#include <QHash>
 
 #include <QStyleFactory>
 
@@ -52,6 +54,24 @@ public:
     virtual ~WhiteMenu() {}
 };
 
+///
+/// \brief The WindowConfig struct holds everything the dock window size
+/// depends on, see DockSettings::calculateWindowSize.
+///
+struct WindowConfig
+{
+    DisplayMode displayMode;
+    Position position;
+    int visibleItemCount;
+    int itemWidth;
+    int itemHeight;
+    QSize primarySize;
+
+    bool operator==(const WindowConfig &other) const;
+};
+
+uint qHash(const WindowConfig &config, uint seed = 0);
+
 class DockSettings : public QObject
 {
     Q_OBJECT
@@ -74,12 +94,15 @@ public:
     inline const QRect primaryRawRect() const { return m_primaryRawRect; }
     inline const QRect frontendWindowRect() const { return m_frontendRect; }
     inline const QSize windowSize() const { return m_mainWindowSize; }
+    inline int itemCount(const DockItem::ItemType type) const { return m_itemTypeCount.value(type); }
 
     const QSize panelSize() const;
     const QRect windowRect(const Position position, const bool hide = false) const;
 
     void showDockSettingsMenu();
 
+    static const QSize calculateWindowSize(const WindowConfig &config);
+
 signals:
     void dataChanged() const;
     void positionChanged(const Position prevPosition) const;
@@ -100,13 +123,18 @@ private slots:
     void onDisplayModeChanged();
     void hideModeChanged();
     void hideStateChanged();
+    void dockItemInserted(const int index, DockItem *item);
+    void dockItemRemoved(DockItem *item);
     void dockItemCountChanged();
     void primaryScreenChanged();
     void resetFrontendGeometry();
+    void dockServiceRestarted();
+    void frontendGeometrySettled(const QRect &rect);
     void updateForbidPostions();
 
 private:
     bool test(const Position pos, const QList<QRect> &otherScreens) const;
+    int visibleItemCount() const;
     void calculateWindowConfig();
     void gtkIconThemeChanged();
 
@@ -124,6 +152,8 @@ private:
     QRect m_primaryRawRect;
     QRect m_frontendRect;
     QSize m_mainWindowSize;
+    QHash<WindowConfig, QSize> m_windowSizeCache;
+    QHash<DockItem::ItemType, int> m_itemTypeCount;
 
     WhiteMenu m_settingsMenu;
     WhiteMenu *m_hideSubMenu;
@@ -143,6 +173,7 @@ private:
     DBusDisplay *m_displayInter;
     DBusDock *m_dockInter;
     DockItemController *m_itemController;
+    GeometryNotifier *m_frontendNotifier;
 };
 
 #endif // DOCKSETTINGS_H
@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "eventlooptracer.h"
+
+#include <QTimer>
+#include <QFile>
+#include <QThread>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonDocument>
+#include <QCoreApplication>
+#include <QAbstractEventDispatcher>
+#include <QDebug>
+
+#include <unistd.h>
+#include <algorithm>
+
+#define HEARTBEAT_INTERVAL      50
+#define STALL_THRESHOLD_US      16000
+#define MAX_TRACE_EVENTS        200000
+
+bool EventLoopTracer::Active = false;
+// upper bounds of histogram buckets in microseconds, the last bucket is open
+const QVector<qint64> EventLoopTracer::BucketLimits = { 1000, 4000, 16000, 50000, 100000, 250000 };
+
+EventLoopTracer *EventLoopTracer::instance()
+{
+    static EventLoopTracer *INSTANCE = new EventLoopTracer(qApp);
+
+    return INSTANCE;
+}
+
+EventLoopTracer::EventLoopTracer(QObject *parent)
+    : QObject(parent),
+      m_heartbeatTimer(new QTimer(this)),
+      m_lastBeatUs(0),
+      m_awakeUs(-1)
+{
+    m_clock.start();
+
+    m_heartbeatTimer->setTimerType(Qt::PreciseTimer);
+    m_heartbeatTimer->setInterval(HEARTBEAT_INTERVAL);
+
+    connect(m_heartbeatTimer, &QTimer::timeout, this, &EventLoopTracer::onHeartbeat);
+}
+
+void EventLoopTracer::setEnabled(const bool enabled)
+{
+    if (Active == enabled)
+        return;
+
+    Active = enabled;
+
+    QAbstractEventDispatcher *dispatcher = QAbstractEventDispatcher::instance(thread());
+    if (enabled)
+    {
+        connect(dispatcher, &QAbstractEventDispatcher::awake, this, &EventLoopTracer::onAwake, Qt::UniqueConnection);
+        connect(dispatcher, &QAbstractEventDispatcher::aboutToBlock, this, &EventLoopTracer::onAboutToBlock, Qt::UniqueConnection);
+
+        m_lastBeatUs = m_clock.nsecsElapsed() / 1000;
+        m_heartbeatTimer->start();
+    } else {
+        disconnect(dispatcher, &QAbstractEventDispatcher::awake, this, &EventLoopTracer::onAwake);
+        disconnect(dispatcher, &QAbstractEventDispatcher::aboutToBlock, this, &EventLoopTracer::onAboutToBlock);
+
+        m_heartbeatTimer->stop();
+        m_awakeUs = -1;
+    }
+
+    qDebug() << "event loop tracer enabled:" << enabled;
+}
+
+void EventLoopTracer::complete(const char *name, const qint64 nsecs)
+{
+    const qint64 durUs = nsecs / 1000;
+    const qint64 startUs = m_clock.nsecsElapsed() / 1000 - durUs;
+    const QString n = QString::fromLatin1(name);
+
+    QMutexLocker locker(&m_mutex);
+    m_scopeHistograms[n].add(durUs);
+    locker.unlock();
+
+    appendEvent(n, startUs, durUs);
+}
+
+const QString EventLoopTracer::summary() const
+{
+    auto toJson = [](const Histogram &h) {
+        QJsonArray buckets;
+        for (int i(0); i != h.buckets.size(); ++i)
+        {
+            QJsonObject bucket;
+            bucket["le_us"] = i < BucketLimits.size() ? BucketLimits[i] : -1;
+            bucket["count"] = h.buckets[i];
+            buckets << bucket;
+        }
+
+        QJsonObject obj;
+        obj["count"] = h.count;
+        obj["max_us"] = h.max;
+        obj["buckets"] = buckets;
+        return obj;
+    };
+
+    QMutexLocker locker(&m_mutex);
+
+    QJsonObject scopes;
+    for (auto it(m_scopeHistograms.cbegin()); it != m_scopeHistograms.cend(); ++it)
+        scopes[it.key()] = toJson(it.value());
+
+    QJsonObject result;
+    result["enabled"] = Active;
+    result["iteration_busy"] = toJson(m_busyHistogram);
+    result["timer_lag"] = toJson(m_lagHistogram);
+    result["scopes"] = scopes;
+
+    return QJsonDocument(result).toJson(QJsonDocument::Compact);
+}
+
+bool EventLoopTracer::writeTrace(const QString &path) const
+{
+    QFile f(path);
+    if (!f.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning() << "write trace failed:" << path << f.errorString();
+        return false;
+    }
+
+    const qint64 pid = getpid();
+
+    QJsonArray events;
+    QMutexLocker locker(&m_mutex);
+    for (const auto &e : m_events)
+    {
+        QJsonObject obj;
+        obj["name"] = e.name;
+        obj["ph"] = "X";
+        obj["ts"] = e.ts;
+        obj["dur"] = e.dur;
+        obj["pid"] = pid;
+        obj["tid"] = qint64(e.tid);
+        events << obj;
+    }
+    locker.unlock();
+
+    QJsonObject trace;
+    trace["traceEvents"] = events;
+    trace["displayTimeUnit"] = "ms";
+
+    f.write(QJsonDocument(trace).toJson(QJsonDocument::Compact));
+
+    return true;
+}
+
+void EventLoopTracer::appendEvent(const QString &name, const qint64 startUs, const qint64 durUs)
+{
+    QMutexLocker locker(&m_mutex);
+
+    // keep memory bounded on long sessions, the oldest half is dropped
+    if (m_events.size() >= MAX_TRACE_EVENTS)
+        m_events.remove(0, MAX_TRACE_EVENTS / 2);
+
+    m_events.append(TraceEvent { name, startUs, durUs, quintptr(QThread::currentThreadId()) });
+}
+
+void EventLoopTracer::onAwake()
+{
+    m_awakeUs = m_clock.nsecsElapsed() / 1000;
+}
+
+void EventLoopTracer::onAboutToBlock()
+{
+    if (m_awakeUs < 0)
+        return;
+
+    const qint64 busyUs = m_clock.nsecsElapsed() / 1000 - m_awakeUs;
+
+    QMutexLocker locker(&m_mutex);
+    m_busyHistogram.add(busyUs);
+    locker.unlock();
+
+    if (busyUs >= STALL_THRESHOLD_US)
+        appendEvent("EventLoop::stall", m_awakeUs, busyUs);
+
+    m_awakeUs = -1;
+}
+
+void EventLoopTracer::onHeartbeat()
+{
+    const qint64 nowUs = m_clock.nsecsElapsed() / 1000;
+    const qint64 lagUs = std::max<qint64>(0, nowUs - m_lastBeatUs - HEARTBEAT_INTERVAL * 1000);
+    m_lastBeatUs = nowUs;
+
+    QMutexLocker locker(&m_mutex);
+    m_lagHistogram.add(lagUs);
+}
+
+void EventLoopTracer::Histogram::add(const qint64 us)
+{
+    int i = 0;
+    while (i != BucketLimits.size() && us > BucketLimits[i])
+        ++i;
+
+    ++buckets[i];
+    ++count;
+    max = std::max(max, us);
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EVENTLOOPTRACER_H
+#define EVENTLOOPTRACER_H
+
+#include <QObject>
+#include <QMutex>
+#include <QVector>
+#include <QMap>
+#include <QElapsedTimer>
+
+class QTimer;
+
+///
+/// \brief The EventLoopTracer class records main loop stalls, timer lag and
+/// every profiled scope as chrome trace events. It is off by default and
+/// enabled by DDE_DOCK_TRACE (the trace file written on exit) or over D-Bus.
+///
+class EventLoopTracer : public QObject
+{
+    Q_OBJECT
+
+public:
+    static EventLoopTracer *instance();
+    static inline bool active() { return Active; }
+
+    void setEnabled(const bool enabled);
+    void complete(const char *name, const qint64 nsecs);
+    const QString summary() const;
+    bool writeTrace(const QString &path) const;
+
+private:
+    explicit EventLoopTracer(QObject *parent = nullptr);
+
+    void appendEvent(const QString &name, const qint64 startUs, const qint64 durUs);
+
+private slots:
+    void onAwake();
+    void onAboutToBlock();
+    void onHeartbeat();
+
+private:
+    struct TraceEvent
+    {
+        QString name;
+        qint64 ts;
+        qint64 dur;
+        quintptr tid;
+    };
+
+    struct Histogram
+    {
+        QVector<int> buckets = QVector<int>(BucketLimits.size() + 1, 0);
+        qint64 count = 0;
+        qint64 max = 0;
+
+        void add(const qint64 us);
+    };
+
+    static bool Active;
+    static const QVector<qint64> BucketLimits;
+
+    QElapsedTimer m_clock;
+    QTimer *m_heartbeatTimer;
+    qint64 m_lastBeatUs;
+    qint64 m_awakeUs;
+
+    mutable QMutex m_mutex;
+    QVector<TraceEvent> m_events;
+    Histogram m_busyHistogram;
+    Histogram m_lagHistogram;
+    QMap<QString, Histogram> m_scopeHistograms;
+};
+
+#endif // EVENTLOOPTRACER_H
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "geometrynotifier.h"
+
+GeometryNotifier::GeometryNotifier(const int settleInterval, QObject *parent)
+    : QObject(parent),
+
+      m_settleTimer(new QTimer(this)),
+      m_sequence(0)
+{
+    m_settleTimer->setSingleShot(true);
+    m_settleTimer->setInterval(settleInterval);
+
+    connect(m_settleTimer, &QTimer::timeout, this, &GeometryNotifier::settle);
+}
+
+void GeometryNotifier::update(const QRect &rect)
+{
+    m_pending = rect;
+    m_settleTimer->start();
+}
+
+///
+/// \brief GeometryNotifier::reset forget the published rect, the next settled
+/// update will be emitted even if it equals the previous one.
+///
+void GeometryNotifier::reset()
+{
+    m_published = QRect();
+}
+
+void GeometryNotifier::settle()
+{
+    if (m_pending == m_published)
+        return;
+
+    m_published = m_pending;
+    ++m_sequence;
+
+    emit geometrySettled(m_published, m_sequence);
+}
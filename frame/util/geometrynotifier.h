@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GEOMETRYNOTIFIER_H
+#define GEOMETRYNOTIFIER_H
+
+#include <QObject>
+#include <QTimer>
+#include <QRect>
+
+///
+/// \brief The GeometryNotifier class coalesces a burst of geometry updates
+/// into one notification once the geometry has settled, and only when the
+/// settled rect differs from the last published one.
+///
+class GeometryNotifier : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit GeometryNotifier(const int settleInterval, QObject *parent = nullptr);
+
+    inline const QRect published() const { return m_published; }
+    inline quint64 sequence() const { return m_sequence; }
+
+signals:
+    void geometrySettled(const QRect &rect, const quint64 sequence) const;
+
+public slots:
+    void update(const QRect &rect);
+    void reset();
+
+private slots:
+    void settle();
+
+private:
+    QTimer *m_settleTimer;
+    QRect m_pending;
+    QRect m_published;
+    quint64 m_sequence;
+};
+
+#endif // GEOMETRYNOTIFIER_H
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "hotpathprofiler.h"
+
+#include <QMap>
+#include <QFile>
+#include <QMutex>
+#include <QJsonObject>
+#include <QJsonDocument>
+#include <QDebug>
+
+#include <limits>
+#include <sys/resource.h>
+#include <algorithm>
+
+namespace {
+
+struct Sample
+{
+    qint64 count = 0;
+    qint64 total = 0;
+    qint64 min = std::numeric_limits<qint64>::max();
+    qint64 max = 0;
+};
+
+QMutex SamplesLock;
+QMap<QString, Sample> Samples;
+
+}
+
+bool HotPathProfiler::enabled()
+{
+    static const bool Enabled = !qgetenv("DDE_DOCK_PROFILE").isEmpty();
+
+    return Enabled;
+}
+
+void HotPathProfiler::record(const char *name, const qint64 nsecs)
+{
+    QMutexLocker locker(&SamplesLock);
+
+    Sample &s = Samples[QString::fromLatin1(name)];
+    ++s.count;
+    s.total += nsecs;
+    s.min = std::min(s.min, nsecs);
+    s.max = std::max(s.max, nsecs);
+}
+
+const QByteArray HotPathProfiler::toJson()
+{
+    QMutexLocker locker(&SamplesLock);
+
+    QJsonObject result;
+    for (auto it(Samples.cbegin()); it != Samples.cend(); ++it)
+    {
+        const Sample &s = it.value();
+
+        QJsonObject obj;
+        obj["count"] = s.count;
+        obj["total_us"] = s.total / 1000;
+        obj["avg_us"] = s.total / s.count / 1000.;
+        obj["min_us"] = s.min / 1000.;
+        obj["max_us"] = s.max / 1000.;
+
+        result[it.key()] = obj;
+    }
+
+    // process wide counters, so load runs can be compared by cpu time and wakeups
+    struct rusage usage;
+    if (!getrusage(RUSAGE_SELF, &usage))
+    {
+        QJsonObject process;
+        process["user_ms"] = qint64(usage.ru_utime.tv_sec) * 1000 + usage.ru_utime.tv_usec / 1000;
+        process["system_ms"] = qint64(usage.ru_stime.tv_sec) * 1000 + usage.ru_stime.tv_usec / 1000;
+        process["voluntary_switches"] = qint64(usage.ru_nvcsw);
+        process["involuntary_switches"] = qint64(usage.ru_nivcsw);
+        process["max_rss_kb"] = qint64(usage.ru_maxrss);
+
+        result["process"] = process;
+    }
+
+    return QJsonDocument(result).toJson();
+}
+
+void HotPathProfiler::dump()
+{
+    if (!enabled())
+        return;
+
+    QFile f(QString::fromLocal8Bit(qgetenv("DDE_DOCK_PROFILE")));
+    if (!f.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning() << "write profile failed:" << f.fileName() << f.errorString();
+        return;
+    }
+
+    f.write(toJson());
+}
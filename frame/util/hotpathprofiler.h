@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HOTPATHPROFILER_H
+#define HOTPATHPROFILER_H
+
+#include "eventlooptracer.h"
+
+#include <QString>
+#include <QByteArray>
+#include <QElapsedTimer>
+
+///
+/// \brief The HotPathProfiler class collects call counts and durations of
+/// the dock hot paths when DDE_DOCK_PROFILE is set to an output file, and
+/// writes them as json on exit so results can be compared between releases.
+///
+class HotPathProfiler
+{
+public:
+    static bool enabled();
+    static void record(const char *name, const qint64 nsecs);
+    static const QByteArray toJson();
+    static void dump();
+};
+
+class HotPathTimer
+{
+public:
+    explicit inline HotPathTimer(const char *name)
+        : m_name(name)
+    {
+        if (HotPathProfiler::enabled() || EventLoopTracer::active())
+            m_timer.start();
+    }
+
+    inline ~HotPathTimer()
+    {
+        if (!m_timer.isValid())
+            return;
+
+        const qint64 nsecs = m_timer.nsecsElapsed();
+        if (HotPathProfiler::enabled())
+            HotPathProfiler::record(m_name, nsecs);
+        if (EventLoopTracer::active())
+            EventLoopTracer::instance()->complete(m_name, nsecs);
+    }
+
+private:
+    const char *m_name;
+    QElapsedTimer m_timer;
+};
+
+// __LINE__ makes the timer name unique, so one scope can hold several probes
+#define PROFILE_HOT_PATH_CONCAT_(a, b)  a##b
+#define PROFILE_HOT_PATH_CONCAT(a, b)   PROFILE_HOT_PATH_CONCAT_(a, b)
+#define PROFILE_HOT_PATH(name)          HotPathTimer PROFILE_HOT_PATH_CONCAT(hotPathTimer_, __LINE__)(name)
+
+#endif // HOTPATHPROFILER_H
@@ -20,6 +20,7 @@
  */
 
 #include "imagefactory.h"
+#include "hotpathprofiler.h"
 
 #include <QDebug>
 #include <QPainter>
@@ -32,6 +33,8 @@ ImageFactory::ImageFactory(QObject *parent)
 
 QPixmap ImageFactory::lighterEffect(const QPixmap pixmap, const int delta)
 {
+    PROFILE_HOT_PATH("ImageFactory::lighterEffect");
+
     QImage image = pixmap.toImage();
 
     const int width = image.width();
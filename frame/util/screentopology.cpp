@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "screentopology.h"
+
+#include <QGuiApplication>
+#include <QScreen>
+
+ScreenTopology *ScreenTopology::instance()
+{
+    static ScreenTopology *INSTANCE = new ScreenTopology(qApp);
+
+    return INSTANCE;
+}
+
+ScreenTopology::ScreenTopology(QObject *parent)
+    : QObject(parent),
+
+      m_primary(0)
+{
+    for (auto *screen : qApp->screens())
+        screenAdded(screen);
+
+    connect(qApp, &QGuiApplication::screenAdded, this, &ScreenTopology::screenAdded);
+    connect(qApp, &QGuiApplication::screenRemoved, this, &ScreenTopology::refresh, Qt::QueuedConnection);
+    connect(qApp, &QGuiApplication::primaryScreenChanged, this, &ScreenTopology::refresh);
+
+    refresh();
+}
+
+const QPoint ScreenTopology::rawXPosition(const QPoint &scaledPos) const
+{
+    return rawXPosition(m_screens, m_primary, scaledPos);
+}
+
+const QPoint ScreenTopology::scaledPos(const QPoint &rawXPos) const
+{
+    return scaledPos(m_screens, m_primary, rawXPos);
+}
+
+///
+/// \brief ScreenTopology::rawXPosition map a scaled position to raw X
+/// coordinates, using the screen whose logical rect contains it, or the
+/// primary screen if none does.
+///
+const QPoint ScreenTopology::rawXPosition(const QVector<Screen> &screens, const int primary, const QPoint &scaledPos)
+{
+    if (screens.isEmpty())
+        return scaledPos;
+
+    const Screen *s = &screens[qBound(0, primary, screens.size() - 1)];
+    for (const auto &screen : screens)
+    {
+        if (screen.logical.contains(scaledPos))
+        {
+            s = &screen;
+            break;
+        }
+    }
+
+    return s->native.topLeft() + (scaledPos - s->logical.topLeft()) * s->ratio;
+}
+
+///
+/// \brief ScreenTopology::scaledPos the reverse of rawXPosition, looked up
+/// by native rect.
+///
+const QPoint ScreenTopology::scaledPos(const QVector<Screen> &screens, const int primary, const QPoint &rawXPos)
+{
+    if (screens.isEmpty())
+        return rawXPos;
+
+    const Screen *s = &screens[qBound(0, primary, screens.size() - 1)];
+    for (const auto &screen : screens)
+    {
+        if (screen.native.contains(rawXPos))
+        {
+            s = &screen;
+            break;
+        }
+    }
+
+    return s->logical.topLeft() + (rawXPos - s->native.topLeft()) / s->ratio;
+}
+
+void ScreenTopology::screenAdded(QScreen *screen)
+{
+    connect(screen, &QScreen::geometryChanged, this, &ScreenTopology::refresh, Qt::UniqueConnection);
+
+    // constructor calls refresh once for all initial screens
+    if (sender())
+        refresh();
+}
+
+void ScreenTopology::refresh()
+{
+    const auto screens = qApp->screens();
+    QScreen *primary = qApp->primaryScreen();
+
+    m_screens.clear();
+    m_screens.reserve(screens.size());
+    m_primary = 0;
+
+    for (auto *screen : screens)
+    {
+        Screen s;
+        s.logical = screen->geometry();
+        s.ratio = screen->devicePixelRatio();
+        // the native origin of a screen is not scaled, only its size is
+        s.native = QRect(s.logical.topLeft(), s.logical.size() * s.ratio);
+
+        if (screen == primary)
+            m_primary = m_screens.size();
+        m_screens.append(s);
+    }
+
+    emit topologyChanged();
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCREENTOPOLOGY_H
+#define SCREENTOPOLOGY_H
+
+#include <QObject>
+#include <QVector>
+#include <QRect>
+
+class QScreen;
+
+///
+/// \brief The ScreenTopology class caches the logical and native X geometry
+/// of every screen, so mapping between scaled widget coordinates and raw X
+/// coordinates no longer walks qApp->screens() on each call. The cache is
+/// rebuilt only when a screen is added, removed or changes geometry.
+///
+class ScreenTopology : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Screen
+    {
+        QRect logical;
+        QRect native;
+        qreal ratio;
+    };
+
+    static ScreenTopology *instance();
+
+    inline const QVector<Screen> &screens() const { return m_screens; }
+    inline int primaryIndex() const { return m_primary; }
+
+    const QPoint rawXPosition(const QPoint &scaledPos) const;
+    const QPoint scaledPos(const QPoint &rawXPos) const;
+
+    static const QPoint rawXPosition(const QVector<Screen> &screens, const int primary, const QPoint &scaledPos);
+    static const QPoint scaledPos(const QVector<Screen> &screens, const int primary, const QPoint &rawXPos);
+
+signals:
+    void topologyChanged() const;
+
+private:
+    explicit ScreenTopology(QObject *parent = nullptr);
+
+private slots:
+    void screenAdded(QScreen *screen);
+    void refresh();
+
+private:
+    QVector<Screen> m_screens;
+    int m_primary;
+};
+
+#endif // SCREENTOPOLOGY_H
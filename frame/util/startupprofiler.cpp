@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "startupprofiler.h"
+
+#include <QFile>
+#include <QMetaEnum>
+#include <QJsonObject>
+#include <QJsonDocument>
+
+#include <unistd.h>
+#include <algorithm>
+
+// time between process start and the first profiler call, read from /proc
+static qint64 processUptimeMs()
+{
+    QFile stat("/proc/self/stat");
+    QFile uptime("/proc/uptime");
+    if (!stat.open(QIODevice::ReadOnly) || !uptime.open(QIODevice::ReadOnly))
+        return 0;
+
+    // the command name may contain spaces, fields are counted after its closing paren
+    const QByteArray s = stat.readAll();
+    const QList<QByteArray> fields = s.mid(s.lastIndexOf(')') + 2).split(' ');
+    if (fields.size() < 20)
+        return 0;
+
+    const qint64 startTicks = fields.at(19).toLongLong();
+    const double systemUptime = uptime.readAll().split(' ').first().toDouble();
+    const qint64 ticks = sysconf(_SC_CLK_TCK);
+
+    return std::max<qint64>(0, systemUptime * 1000 - startTicks * 1000 / ticks);
+}
+
+StartupProfiler *StartupProfiler::instance()
+{
+    static StartupProfiler *INSTANCE = new StartupProfiler;
+
+    return INSTANCE;
+}
+
+StartupProfiler::StartupProfiler(QObject *parent)
+    : QObject(parent),
+      m_processStartOffset(processUptimeMs()),
+      m_timestamps(PhaseCount, -1)
+{
+    m_clock.start();
+    m_timestamps[ProcessStart] = 0;
+}
+
+void StartupProfiler::mark(const Phase phase)
+{
+    if (reached(phase))
+        return;
+
+    m_timestamps[phase] = m_clock.elapsed() + m_processStartOffset;
+
+    emit phaseReached(phase);
+}
+
+bool StartupProfiler::reached(const Phase phase) const
+{
+    return m_timestamps[phase] != -1;
+}
+
+qint64 StartupProfiler::elapsed(const Phase phase) const
+{
+    return m_timestamps[phase];
+}
+
+const QString StartupProfiler::summary() const
+{
+    const QMetaEnum phaseEnum = QMetaEnum::fromType<Phase>();
+
+    QJsonObject result;
+    for (int i(0); i != PhaseCount; ++i)
+        result[phaseEnum.valueToKey(i)] = m_timestamps[i];
+
+    return QJsonDocument(result).toJson(QJsonDocument::Compact);
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef STARTUPPROFILER_H
+#define STARTUPPROFILER_H
+
+#include <QObject>
+#include <QVector>
+#include <QElapsedTimer>
+
+///
+/// \brief The StartupProfiler class timestamps the launch phases of the dock,
+/// relative to process start, so later phases can wait on earlier ones and
+/// time-to-interactive can be reported over D-Bus.
+///
+class StartupProfiler : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Phase
+    {
+        ProcessStart,
+        DBusReady,
+        SettingsLoaded,
+        AppsPopulated,
+        FirstPanelPaint,
+        StrutsSet,
+        PluginsReady,
+        PhaseCount,
+    };
+    Q_ENUM(Phase)
+
+    static StartupProfiler *instance();
+
+    void mark(const Phase phase);
+    bool reached(const Phase phase) const;
+    qint64 elapsed(const Phase phase) const;
+    const QString summary() const;
+
+signals:
+    void phaseReached(const Phase phase) const;
+
+private:
+    explicit StartupProfiler(QObject *parent = nullptr);
+
+private:
+    QElapsedTimer m_clock;
+    qint64 m_processStartOffset;
+    QVector<qint64> m_timestamps;
+};
+
+#endif // STARTUPPROFILER_H
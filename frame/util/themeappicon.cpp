@@ -20,6 +20,7 @@
  */
 
 #include "themeappicon.h"
+#include "hotpathprofiler.h"
 
 #include <QIcon>
 #include <QFile>
@@ -38,6 +39,8 @@ ThemeAppIcon::~ThemeAppIcon()
 
 const QPixmap ThemeAppIcon::getIcon(const QString iconName, const int size)
 {
+    PROFILE_HOT_PATH("ThemeAppIcon::getIcon");
+
     const auto ratio = qApp->devicePixelRatio();
     const int s = int(size * ratio) & ~1;
 
@@ -21,6 +21,8 @@
 
 #include "mainwindow.h"
 #include "panel/mainpanel.h"
+#include "util/startupprofiler.h"
+#include "util/screentopology.h"
 
 #include <QDebug>
 #include <QEvent>
@@ -35,38 +37,6 @@
 #include <X11/X.h>
 #include <X11/Xutil.h>
 
-const QPoint rawXPosition(const QPoint &scaledPos)
-{
-    QRect g = qApp->primaryScreen()->geometry();
-    for (auto *screen : qApp->screens())
-    {
-        const QRect &sg = screen->geometry();
-        if (sg.contains(scaledPos))
-        {
-            g = sg;
-            break;
-        }
-    }
-
-    return g.topLeft() + (scaledPos - g.topLeft()) * qApp->devicePixelRatio();
-}
-
-const QPoint scaledPos(const QPoint &rawXPos)
-{
-    QRect g = qApp->primaryScreen()->geometry();
-    for (auto *screen : qApp->screens())
-    {
-        const QRect &sg = screen->geometry();
-        if (sg.contains(rawXPos))
-        {
-            g = sg;
-            break;
-        }
-    }
-
-    return g.topLeft() + (rawXPos - g.topLeft()) / qApp->devicePixelRatio();
-}
-
 MainWindow::MainWindow(QWidget *parent)
     : QWidget(parent),
 
@@ -82,12 +52,15 @@ MainWindow::MainWindow(QWidget *parent)
       m_expandDelayTimer(new QTimer(this)),
       m_leaveDelayTimer(new QTimer(this)),
       m_shadowMaskOptimizeTimer(new QTimer(this)),
+      m_positionNotifier(new GeometryNotifier(1, this)),
+      m_geometryNotifier(new GeometryNotifier(500, this)),
 
       m_sizeChangeAni(new QVariantAnimation(this)),
       m_posChangeAni(new QVariantAnimation(this)),
       m_panelShowAni(new QPropertyAnimation(m_mainPanel, "pos")),
       m_panelHideAni(new QPropertyAnimation(m_mainPanel, "pos")),
-      m_xcbMisc(XcbMisc::instance())
+      m_xcbMisc(XcbMisc::instance()),
+      m_strutManager(new StrutManager(this))
 
 {
     setAccessibleName("dock-mainwindow");
@@ -104,12 +77,14 @@ MainWindow::MainWindow(QWidget *parent)
     m_platformWindowHandle.setShadowRadius(0);
 
     m_settings = new DockSettings(this);
+    StartupProfiler::instance()->mark(StartupProfiler::SettingsLoaded);
     m_xcbMisc->set_window_type(winId(), XcbMisc::Dock);
 
     initComponents();
     initConnections();
 
     m_mainPanel->setFixedSize(m_settings->panelSize());
+    m_mainPanel->installEventFilter(this);
 }
 
 MainWindow::~MainWindow()
@@ -124,27 +99,38 @@ void MainWindow::launch()
     resetPanelEnvironment(false);
     setVisible(false);
 
-    QTimer::singleShot(400, this, [&] {
-        m_launched = true;
-        m_mainPanel->setVisible(true);
-        resetPanelEnvironment(false);
-        updateGeometry();
-        expand();
-    });
+    // the panel slides in once the window is shown, see showEvent
+    qApp->processEvents();
+    QTimer::singleShot(1, this, &MainWindow::show);
+}
 
-    // set strut
-    QTimer::singleShot(600, this, [&] {
-        setStrutPartial();
-    });
+void MainWindow::launchPanel()
+{
+    if (m_launched)
+        return;
 
-    // reset to right environment when animation finished
-    QTimer::singleShot(800, this, [&] {
-        m_updatePanelVisible = true;
-        updatePanelVisible();
-    });
+    m_launched = true;
+    m_mainPanel->setVisible(true);
+    resetPanelEnvironment(false);
+    updateGeometry();
+    expand();
 
-    qApp->processEvents();
-    QTimer::singleShot(1, this, &MainWindow::show);
+    // set strut and reset to right environment when the slide in animation finished
+    if (m_panelShowAni->state() == QPropertyAnimation::Running)
+        connect(m_panelShowAni, &QPropertyAnimation::finished, this, &MainWindow::finishLaunch, Qt::UniqueConnection);
+    else
+        QMetaObject::invokeMethod(this, "finishLaunch", Qt::QueuedConnection);
+}
+
+void MainWindow::finishLaunch()
+{
+    disconnect(m_panelShowAni, &QPropertyAnimation::finished, this, &MainWindow::finishLaunch);
+
+    setStrutPartial();
+    StartupProfiler::instance()->mark(StartupProfiler::StrutsSet);
+
+    m_updatePanelVisible = true;
+    updatePanelVisible();
 }
 
 bool MainWindow::event(QEvent *e)
@@ -153,7 +139,11 @@ bool MainWindow::event(QEvent *e)
     {
     case QEvent::Move:
         if (!e->spontaneous())
-            QTimer::singleShot(1, this, &MainWindow::positionCheck);
+            m_positionNotifier->update(geometry());
+        m_geometryNotifier->update(geometry());
+        break;
+    case QEvent::Resize:
+        m_geometryNotifier->update(geometry());
         break;
     default:;
     }
@@ -161,6 +151,17 @@ bool MainWindow::event(QEvent *e)
     return QWidget::event(e);
 }
 
+bool MainWindow::eventFilter(QObject *o, QEvent *e)
+{
+    if (o == m_mainPanel && e->type() == QEvent::Paint && m_launched)
+    {
+        m_mainPanel->removeEventFilter(this);
+        StartupProfiler::instance()->mark(StartupProfiler::FirstPanelPaint);
+    }
+
+    return QWidget::eventFilter(o, e);
+}
+
 void MainWindow::showEvent(QShowEvent *e)
 {
     QWidget::showEvent(e);
@@ -168,6 +169,9 @@ void MainWindow::showEvent(QShowEvent *e)
     m_platformWindowHandle.setEnableBlurWindow(false);
     m_platformWindowHandle.setShadowOffset(QPoint());
     m_platformWindowHandle.setShadowRadius(0);
+
+    if (!m_launched)
+        QMetaObject::invokeMethod(this, "launchPanel", Qt::QueuedConnection);
 }
 
 void MainWindow::mousePressEvent(QMouseEvent *e)
@@ -280,6 +284,9 @@ void MainWindow::compositeChanged()
     m_panelHideAni->setDuration(duration);
     m_mainPanel->setEffectEnabled(composite);
 
+    // a restarted window manager or compositor has not seen our strut yet
+    m_strutManager->invalidate();
+
     m_shadowMaskOptimizeTimer->start();
     m_positionUpdateTimer->start();
 }
@@ -292,7 +299,7 @@ void MainWindow::internalMove(const QPoint &p)
     if (!pos_adjust)
         return QWidget::move(p);
 
-    QPoint rp = rawXPosition(p);
+    QPoint rp = ScreenTopology::instance()->rawXPosition(p);
     const auto ratio = devicePixelRatioF();
 
     const QRect &r = m_settings->primaryRawRect();
@@ -339,12 +346,14 @@ void MainWindow::initConnections()
 
     connect(m_mainPanel, &MainPanel::requestRefershWindowVisible, this, &MainWindow::updatePanelVisible, Qt::QueuedConnection);
     connect(m_mainPanel, &MainPanel::requestWindowAutoHide, m_settings, &DockSettings::setAutoHide);
-    connect(m_mainPanel, &MainPanel::geometryChanged, this, &MainWindow::panelGeometryChanged);
+    // the adaptor reports our global rect, so that is what has to settle
+    connect(m_geometryNotifier, &GeometryNotifier::geometrySettled, this, &MainWindow::panelGeometryChanged);
 
     connect(m_positionUpdateTimer, &QTimer::timeout, this, &MainWindow::updatePosition, Qt::QueuedConnection);
     connect(m_expandDelayTimer, &QTimer::timeout, this, &MainWindow::expand, Qt::QueuedConnection);
     connect(m_leaveDelayTimer, &QTimer::timeout, this, &MainWindow::updatePanelVisible, Qt::QueuedConnection);
     connect(m_shadowMaskOptimizeTimer, &QTimer::timeout, this, &MainWindow::adjustShadowMask, Qt::QueuedConnection);
+    connect(m_positionNotifier, &GeometryNotifier::geometrySettled, this, &MainWindow::positionCheck);
 
     connect(m_panelHideAni, &QPropertyAnimation::finished, this, &MainWindow::updateGeometry, Qt::QueuedConnection);
     connect(m_panelHideAni, &QPropertyAnimation::finished, m_shadowMaskOptimizeTimer, static_cast<void (QTimer::*)()>(&QTimer::start));
@@ -479,25 +488,22 @@ void MainWindow::updateGeometry()
 
 void MainWindow::clearStrutPartial()
 {
-    m_xcbMisc->clear_strut_partial(winId());
+    m_strutManager->clear();
 }
 
 void MainWindow::setStrutPartial()
 {
-    // first, clear old strut partial
-    clearStrutPartial();
-
     // reset env
     resetPanelEnvironment(true);
 
     if (m_settings->hideMode() != Dock::KeepShowing)
-        return;
+        return m_strutManager->clear();
 
     const auto ratio = devicePixelRatioF();
     const int maxScreenHeight = m_settings->screenRawHeight();
     const int maxScreenWidth = m_settings->screenRawWidth();
     const Position side = m_settings->position();
-    const QPoint &p = rawXPosition(m_posChangeAni->endValue().toPoint());
+    const QPoint &p = ScreenTopology::instance()->rawXPosition(m_posChangeAni->endValue().toPoint());
     const QSize &s = m_settings->windowSize();
     const QRect &primaryRawRect = m_settings->primaryRawRect();
 
@@ -549,8 +555,6 @@ void MainWindow::setStrutPartial()
         Q_ASSERT(false);
     }
 
-    qDebug() << "screen info: " << p << strutArea;
-
     // pass if strut area is intersect with other screen
     int count = 0;
     const QRect pr = m_settings->primaryRect();
@@ -567,10 +571,16 @@ void MainWindow::setStrutPartial()
     {
         qWarning() << "strutArea is intersects with another screen.";
         qWarning() << maxScreenHeight << maxScreenWidth << side << p << s;
-        return;
+        return m_strutManager->clear();
     }
 
-    m_xcbMisc->set_strut_partial(winId(), orientation, strut, strutStart, strutEnd);
+    StrutManager::Strut desired;
+    desired.orientation = orientation;
+    desired.strut = strut;
+    desired.start = strutStart;
+    desired.end = strutEnd;
+
+    m_strutManager->setStrut(desired);
 }
 
 void MainWindow::expand()
@@ -712,7 +722,7 @@ void MainWindow::positionCheck()
     if (m_positionUpdateTimer->isActive())
         return;
 
-    const QPoint scaledFrontPos = scaledPos(m_settings->frontendWindowRect().topLeft());
+    const QPoint scaledFrontPos = ScreenTopology::instance()->scaledPos(m_settings->frontendWindowRect().topLeft());
 
     if (QPoint(pos() - scaledFrontPos).manhattanLength() < 2)
         return;
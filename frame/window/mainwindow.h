@@ -26,6 +26,8 @@
 #include "dbus/dbusdisplay.h"
 #include "dbus/dbusdockadaptors.h"
 #include "util/docksettings.h"
+#include "util/geometrynotifier.h"
+#include "strutmanager.h"
 
 #include <QWidget>
 #include <QTimer>
@@ -50,6 +52,7 @@ public slots:
 private:
     using QWidget::show;
     bool event(QEvent *e);
+    bool eventFilter(QObject *o, QEvent *e);
     void showEvent(QShowEvent *e);
     void mousePressEvent(QMouseEvent *e);
     void keyPressEvent(QKeyEvent *e);
@@ -87,6 +90,9 @@ private slots:
     void adjustShadowMask();
     void positionCheck();
 
+    void launchPanel();
+    void finishLaunch();
+
 private:
     bool m_launched;
     bool m_updatePanelVisible;
@@ -99,12 +105,15 @@ private:
     QTimer *m_expandDelayTimer;
     QTimer *m_leaveDelayTimer;
     QTimer *m_shadowMaskOptimizeTimer;
+    GeometryNotifier *m_positionNotifier;
+    GeometryNotifier *m_geometryNotifier;
     QVariantAnimation *m_sizeChangeAni;
     QVariantAnimation *m_posChangeAni;
     QPropertyAnimation *m_panelShowAni;
     QPropertyAnimation *m_panelHideAni;
 
     XcbMisc *m_xcbMisc;
+    StrutManager *m_strutManager;
     DockSettings *m_settings;
 };
 
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "strutmanager.h"
+
+#include <QWidget>
+
+bool StrutManager::Strut::operator==(const Strut &other) const
+{
+    // all empty struts are the same property value
+    if (isNull() || other.isNull())
+        return isNull() == other.isNull();
+
+    return orientation == other.orientation &&
+           strut == other.strut &&
+           start == other.start &&
+           end == other.end;
+}
+
+StrutManager::StrutManager(QWidget *window)
+    : QObject(window),
+
+      m_window(window),
+      m_flushTimer(new QTimer(this)),
+      m_xcbMisc(XcbMisc::instance()),
+
+      m_writtenValid(false),
+      m_writeCount(0)
+{
+    m_flushTimer->setSingleShot(true);
+    m_flushTimer->setInterval(0);
+
+    connect(m_flushTimer, &QTimer::timeout, this, &StrutManager::flush);
+}
+
+void StrutManager::setStrut(const Strut &strut)
+{
+    m_desired = strut;
+    m_flushTimer->start();
+}
+
+void StrutManager::clear()
+{
+    setStrut(Strut());
+}
+
+///
+/// \brief StrutManager::invalidate forget the last written value, the next
+/// flush writes the property even if nothing changed on our side.
+///
+void StrutManager::invalidate()
+{
+    m_writtenValid = false;
+    m_flushTimer->start();
+}
+
+void StrutManager::flush()
+{
+    if (m_writtenValid && m_desired == m_written)
+        return;
+
+    const xcb_window_t wid = m_window->winId();
+
+    if (m_desired.isNull())
+        m_xcbMisc->clear_strut_partial(wid);
+    else
+        m_xcbMisc->set_strut_partial(wid, m_desired.orientation, m_desired.strut, m_desired.start, m_desired.end);
+
+    m_written = m_desired;
+    m_writtenValid = true;
+    ++m_writeCount;
+}
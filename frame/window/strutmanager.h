@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef STRUTMANAGER_H
+#define STRUTMANAGER_H
+
+#include "xcb/xcb_misc.h"
+
+#include <QObject>
+#include <QTimer>
+
+class QWidget;
+
+///
+/// \brief The StrutManager class owns the _NET_WM_STRUT_PARTIAL property of
+/// a window. Callers declare the desired strut as often as they like, the
+/// property is written at most once per event loop iteration and only when
+/// it differs from the last written value, since every write makes the
+/// window manager recompute its workarea.
+///
+class StrutManager : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Strut
+    {
+        XcbMisc::Orientation orientation = XcbMisc::OrientationTop;
+        uint strut = 0;
+        uint start = 0;
+        uint end = 0;
+
+        inline bool isNull() const { return strut == 0; }
+        bool operator==(const Strut &other) const;
+        inline bool operator!=(const Strut &other) const { return !(*this == other); }
+    };
+
+    explicit StrutManager(QWidget *window);
+
+    void setStrut(const Strut &strut);
+    void clear();
+    void invalidate();
+
+    inline int writeCount() const { return m_writeCount; }
+
+private slots:
+    void flush();
+
+private:
+    QWidget *m_window;
+    QTimer *m_flushTimer;
+    XcbMisc *m_xcbMisc;
+
+    Strut m_desired;
+    Strut m_written;
+    bool m_writtenValid;
+    int m_writeCount;
+};
+
+#endif // STRUTMANAGER_H
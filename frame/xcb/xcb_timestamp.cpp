@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2015 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QDebug>
+#include <QX11Info>
+#include <QApplication>
+
+#include "xcb_timestamp.h"
+#include "util/hotpathprofiler.h"
+
+XcbTimestamp *XcbTimestamp::instance()
+{
+    static XcbTimestamp *INSTANCE = nullptr;
+
+    if (!INSTANCE)
+    {
+        INSTANCE = new XcbTimestamp;
+        qApp->installNativeEventFilter(INSTANCE);
+    }
+
+    return INSTANCE;
+}
+
+XcbTimestamp::XcbTimestamp()
+    : m_lastTime(XCB_CURRENT_TIME),
+      m_xdndDropAtom(XCB_ATOM_NONE)
+{
+    xcb_connection_t *c = QX11Info::connection();
+    if (!c)
+        return;
+
+    const char name[] = "XdndDrop";
+    xcb_intern_atom_reply_t *reply = xcb_intern_atom_reply(c, xcb_intern_atom(c, false, sizeof(name) - 1, name), nullptr);
+    if (!reply)
+        return;
+
+    m_xdndDropAtom = reply->atom;
+    free(reply);
+}
+
+xcb_timestamp_t XcbTimestamp::timestamp()
+{
+    // qt also tracks the time of input it has seen, including xinput2 events
+    update(QX11Info::appTime());
+
+    if (m_lastTime != XCB_CURRENT_TIME)
+        return m_lastTime;
+
+    // nothing seen yet, ask the server
+    PROFILE_HOT_PATH("QX11Info::getTimestamp (blocking)");
+
+    update(QX11Info::getTimestamp());
+
+    return m_lastTime;
+}
+
+bool XcbTimestamp::nativeEventFilter(const QByteArray &eventType, void *message, long *result)
+{
+    Q_UNUSED(result);
+
+    if (eventType != "xcb_generic_event_t")
+        return false;
+
+    xcb_generic_event_t *event = static_cast<xcb_generic_event_t *>(message);
+    switch (event->response_type & ~0x80)
+    {
+    case XCB_KEY_PRESS:
+    case XCB_KEY_RELEASE:
+        update(reinterpret_cast<xcb_key_press_event_t *>(event)->time);
+        break;
+    case XCB_BUTTON_PRESS:
+    case XCB_BUTTON_RELEASE:
+        update(reinterpret_cast<xcb_button_press_event_t *>(event)->time);
+        break;
+    case XCB_MOTION_NOTIFY:
+        update(reinterpret_cast<xcb_motion_notify_event_t *>(event)->time);
+        break;
+    case XCB_ENTER_NOTIFY:
+    case XCB_LEAVE_NOTIFY:
+        update(reinterpret_cast<xcb_enter_notify_event_t *>(event)->time);
+        break;
+    case XCB_PROPERTY_NOTIFY:
+        update(reinterpret_cast<xcb_property_notify_event_t *>(event)->time);
+        break;
+    case XCB_CLIENT_MESSAGE:
+    {
+        // the drop time is the third field, dropEvent runs while this message is handled
+        xcb_client_message_event_t *msg = reinterpret_cast<xcb_client_message_event_t *>(event);
+        if (msg->type == m_xdndDropAtom && m_xdndDropAtom != XCB_ATOM_NONE)
+            update(msg->data.data32[2]);
+        break;
+    }
+    default:;
+    }
+
+    return false;
+}
+
+void XcbTimestamp::update(const xcb_timestamp_t time)
+{
+    if (time == XCB_CURRENT_TIME)
+        return;
+
+    // server time wraps around, compare by signed distance
+    if (m_lastTime == XCB_CURRENT_TIME || qint32(time - m_lastTime) > 0)
+        m_lastTime = time;
+}
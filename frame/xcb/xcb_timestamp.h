@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2015 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef XCB_TIMESTAMP_H
+#define XCB_TIMESTAMP_H
+
+#include <QAbstractNativeEventFilter>
+
+#include <xcb/xcb.h>
+
+///
+/// \brief The XcbTimestamp class remembers the server time of the last input
+/// event or XdndDrop message, so user actions can pass a valid timestamp to the daemon without a
+/// blocking QX11Info::getTimestamp() round trip.
+///
+class XcbTimestamp : public QAbstractNativeEventFilter
+{
+public:
+    static XcbTimestamp *instance();
+
+    xcb_timestamp_t timestamp();
+
+    bool nativeEventFilter(const QByteArray &eventType, void *message, long *result) Q_DECL_OVERRIDE;
+
+private:
+    XcbTimestamp();
+
+    void update(const xcb_timestamp_t time);
+
+private:
+    xcb_timestamp_t m_lastTime;
+    xcb_atom_t m_xdndDropAtom;
+};
+
+#endif // XCB_TIMESTAMP_H
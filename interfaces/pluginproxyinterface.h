@@ -62,6 +62,13 @@ public:
     /// request show context menu
     ///
     virtual void requestContextMenu(PluginsItemInterface * const itemInter, const QString &itemKey) = 0;
+    ///
+    /// \brief rawXPosition
+    /// map a scaled (logical) position to raw X coordinates, using the
+    /// geometry and scale factor of the screen containing it.
+    /// \param scaledPos
+    ///
+    virtual const QPoint rawXPosition(const QPoint &scaledPos) const = 0;
 };
 
 #endif // PLUGINPROXYINTERFACE_H
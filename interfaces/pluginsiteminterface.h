@@ -59,6 +59,12 @@ public:
     ///
     /// \brief itemWidget
     /// your plugin item widget, each item should have a unique key.
+    ///
+    /// dock does not highlight item widgets on hover unless the plugin object
+    /// declares
+    ///     Q_INVOKABLE bool itemHoverEffect(const QString &itemKey);
+    /// and returns true for the item, the widget is then rendered offscreen
+    /// on every paint to be lightened.
     /// \param itemKey
     /// your widget' unqiue key.
     /// \return
@@ -94,6 +100,12 @@ public:
     /// ensure your command do not get user input.
     ///
     /// empty string will be ignored.
+    ///
+    /// a plugin object may also declare
+    ///     Q_INVOKABLE QVariantMap itemCommandDescriptor(const QString &itemKey);
+    /// returning "service", "path", "interface", "method" and "arguments" of a
+    /// session bus call. dock looks it up by name, sends the call directly and
+    /// does not call itemCommand when the result is valid.
     /// \param itemKey
     /// \return
     ///
@@ -24,28 +24,30 @@
 #include <DDBusSender>
 #include <QLabel>
 #include <QDebug>
+#include <QEvent>
 
 DatetimePlugin::DatetimePlugin(QObject *parent)
     : QObject(parent),
 
       m_dateTipsLabel(new QLabel),
 
-      m_refershTimer(new QTimer(this)),
+      m_tickScheduler(new TickScheduler(this)),
       m_settings("deepin", "dde-dock-datetime")
 {
     m_dateTipsLabel->setObjectName("datetime");
     m_dateTipsLabel->setStyleSheet("color:white;"
                                    "padding:0px 3px;");
-
-    m_refershTimer->setInterval(1000);
-    m_refershTimer->start();
+    m_dateTipsLabel->installEventFilter(this);
 
     m_centralWidget = new DatetimeWidget;
 
     connect(m_centralWidget, &DatetimeWidget::requestContextMenu, [this] { m_proxyInter->requestContextMenu(this, QString()); });
     connect(m_centralWidget, &DatetimeWidget::requestUpdateGeometry, [this] { m_proxyInter->itemUpdate(this, QString()); });
 
-    connect(m_refershTimer, &QTimer::timeout, this, &DatetimePlugin::updateCurrentTimeString);
+    // repaint the clock once a minute, tips only need seconds while visible
+    connect(m_tickScheduler, &TickScheduler::minuteTick, m_centralWidget, static_cast<void (DatetimeWidget::*)()>(&DatetimeWidget::update));
+    connect(m_tickScheduler, &TickScheduler::secondTick, this, &DatetimePlugin::updateDateTips);
+    m_tickScheduler->subscribe(m_centralWidget, TickScheduler::Minute);
 }
 
 const QString DatetimePlugin::pluginName() const
@@ -104,10 +106,19 @@ QWidget *DatetimePlugin::itemWidget(const QString &itemKey)
     return m_centralWidget;
 }
 
+bool DatetimePlugin::itemHoverEffect(const QString &itemKey)
+{
+    Q_UNUSED(itemKey);
+
+    return true;
+}
+
 QWidget *DatetimePlugin::itemTipsWidget(const QString &itemKey)
 {
     Q_UNUSED(itemKey);
 
+    updateDateTips(QDateTime::currentDateTime());
+
     return m_dateTipsLabel;
 }
 
@@ -118,10 +129,27 @@ const QString DatetimePlugin::itemCommand(const QString &itemKey)
     return "dbus-send --print-reply --dest=com.deepin.Calendar /com/deepin/Calendar com.deepin.Calendar.RaiseWindow";
 }
 
+QVariantMap DatetimePlugin::itemCommandDescriptor(const QString &itemKey)
+{
+    Q_UNUSED(itemKey);
+
+    QVariantMap descriptor;
+    descriptor["service"] = "com.deepin.Calendar";
+    descriptor["path"] = "/com/deepin/Calendar";
+    descriptor["interface"] = "com.deepin.Calendar";
+    descriptor["method"] = "RaiseWindow";
+
+    return descriptor;
+}
+
 const QString DatetimePlugin::itemContextMenu(const QString &itemKey)
 {
     Q_UNUSED(itemKey);
 
+    // cached until hour format changed
+    if (!m_contextMenu.isNull())
+        return m_contextMenu;
+
     QList<QVariant> items;
     items.reserve(1);
 
@@ -145,7 +173,9 @@ const QString DatetimePlugin::itemContextMenu(const QString &itemKey)
     menu["checkableMenu"] = false;
     menu["singleCheck"] = false;
 
-    return QJsonDocument::fromVariant(menu).toJson();
+    m_contextMenu = QJsonDocument::fromVariant(menu).toJson();
+
+    return m_contextMenu;
 }
 
 void DatetimePlugin::invokedMenuItem(const QString &itemKey, const QString &menuId, const bool checked)
@@ -163,23 +193,33 @@ void DatetimePlugin::invokedMenuItem(const QString &itemKey, const QString &menu
             .call();
     } else {
         m_centralWidget->toggleHourFormat();
+        m_contextMenu.clear();
     }
 }
 
-void DatetimePlugin::updateCurrentTimeString()
+bool DatetimePlugin::eventFilter(QObject *watched, QEvent *event)
 {
-    const QDateTime currentDateTime = QDateTime::currentDateTime();
+    if (watched == m_dateTipsLabel)
+    {
+        switch (event->type())
+        {
+        case QEvent::Show:
+            m_tickScheduler->subscribe(m_dateTipsLabel, TickScheduler::Second);
+            break;
+        case QEvent::Hide:
+            m_tickScheduler->unsubscribe(m_dateTipsLabel);
+            break;
+        default:;
+        }
+    }
 
+    return QObject::eventFilter(watched, event);
+}
+
+void DatetimePlugin::updateDateTips(const QDateTime &current)
+{
     if (m_centralWidget->is24HourFormat())
-        m_dateTipsLabel->setText(currentDateTime.date().toString(Qt::SystemLocaleLongDate) + currentDateTime.toString(" HH:mm:ss"));
+        m_dateTipsLabel->setText(current.date().toString(Qt::SystemLocaleLongDate) + current.toString(" HH:mm:ss"));
     else
-        m_dateTipsLabel->setText(currentDateTime.date().toString(Qt::SystemLocaleLongDate) + currentDateTime.toString(" hh:mm:ss A"));
-
-    const QString currentString = currentDateTime.toString("mm");
-
-    if (currentString == m_currentTimeString)
-        return;
-
-    m_currentTimeString = currentString;
-    m_centralWidget->update();
+        m_dateTipsLabel->setText(current.date().toString(Qt::SystemLocaleLongDate) + current.toString(" hh:mm:ss A"));
 }
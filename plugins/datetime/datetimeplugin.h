@@ -24,8 +24,8 @@
 
 #include "pluginsiteminterface.h"
 #include "datetimewidget.h"
+#include "tickscheduler.h"
 
-#include <QTimer>
 #include <QLabel>
 #include <QSettings>
 
@@ -50,23 +50,29 @@ public:
     void setSortKey(const QString &itemKey, const int order);
 
     QWidget *itemWidget(const QString &itemKey) override;
+    Q_INVOKABLE bool itemHoverEffect(const QString &itemKey);
     QWidget *itemTipsWidget(const QString &itemKey) override;
 
     const QString itemCommand(const QString &itemKey) override;
+    Q_INVOKABLE QVariantMap itemCommandDescriptor(const QString &itemKey);
     const QString itemContextMenu(const QString &itemKey) override;
 
     void invokedMenuItem(const QString &itemKey, const QString &menuId, const bool checked) override;
 
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
 private slots:
-    void updateCurrentTimeString();
+    void updateDateTips(const QDateTime &current);
 
 private:
     QPointer<DatetimeWidget> m_centralWidget;
     QPointer<QLabel> m_dateTipsLabel;
 
-    QTimer *m_refershTimer;
+    TickScheduler *m_tickScheduler;
+
+    QString m_contextMenu;
 
-    QString m_currentTimeString;
     QSettings m_settings;
 };
 
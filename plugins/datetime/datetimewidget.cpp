@@ -57,6 +57,7 @@ void DatetimeWidget::toggleHourFormat()
     m_settings.setValue("24HourFormat", m_24HourFormat);
 
     m_cachedTime.clear();
+    m_cachedText.setText(QString());
     update();
 
     emit requestUpdateGeometry();
@@ -75,6 +76,7 @@ QSize DatetimeWidget::sizeHint() const
 void DatetimeWidget::resizeEvent(QResizeEvent *e)
 {
     m_cachedTime.clear();
+    m_cachedText.setText(QString());
 
     QWidget::resizeEvent(e);
 }
@@ -104,8 +106,22 @@ void DatetimeWidget::paintEvent(QPaintEvent *e)
                 format = "hh:mm\nAP";
         }
 
+        // keep text layout until the displayed text changed
+        const QString text = current.time().toString(format);
+        if (m_cachedText.text() != text)
+        {
+            QTextOption option;
+            option.setAlignment(Qt::AlignHCenter);
+
+            m_cachedText.setText(text);
+            m_cachedText.setTextFormat(Qt::PlainText);
+            m_cachedText.setTextOption(option);
+            m_cachedText.setTextWidth(width());
+            m_cachedText.prepare(painter.transform(), painter.font());
+        }
+
         painter.setPen(Qt::white);
-        painter.drawText(rect(), Qt::AlignCenter, current.time().toString(format));
+        painter.drawStaticText(QPointF(0, (height() - m_cachedText.size().height()) / 2), m_cachedText);
         return;
     }
 
@@ -126,8 +142,10 @@ void DatetimeWidget::paintEvent(QPaintEvent *e)
         const int perfectIconSize = qMin(width(), height()) * 0.8;
         const QRect r = rect();
 
+        updateGlyphAtlas(perfectIconSize, ratio);
+
         // draw background
-        QPixmap background = loadSvg(":/icons/resources/icons/background.svg", QSize(perfectIconSize, perfectIconSize));
+        const QPixmap &background = m_glyphAtlas.background;
         const QPoint backgroundOffset = r.center() - background.rect().center() / ratio;
         p.drawPixmap(backgroundOffset, background);
 
@@ -137,55 +155,38 @@ void DatetimeWidget::paintEvent(QPaintEvent *e)
         const int smallNumWidth = double(smallNumHeight) * 5 / 9;
 
         // draw big num 1
-        const QString bigNum1Path = QString(":/icons/resources/icons/big%1.svg").arg(currentTimeString[0]);
-        const QPixmap bigNum1 = loadSvg(bigNum1Path, QSize(bigNumWidth, bigNumHeight));
         const QPoint bigNum1Offset = backgroundOffset + QPoint(perfectIconSize / 2 - bigNumWidth * 2 + 1, perfectIconSize / 2 - bigNumHeight / 2);
-        p.drawPixmap(bigNum1Offset, bigNum1);
+        p.drawPixmap(bigNum1Offset, m_glyphAtlas.bigNums[currentTimeString[0].digitValue()]);
 
         // draw big num 2
-        const QString bigNum2Path = QString(":/icons/resources/icons/big%1.svg").arg(currentTimeString[1]);
-        const QPixmap bigNum2 = loadSvg(bigNum2Path, QSize(bigNumWidth, bigNumHeight));
         const QPoint bigNum2Offset = bigNum1Offset + QPoint(bigNumWidth + 1, 0);
-        p.drawPixmap(bigNum2Offset, bigNum2);
+        p.drawPixmap(bigNum2Offset, m_glyphAtlas.bigNums[currentTimeString[1].digitValue()]);
 
         if (!m_24HourFormat)
         {
             // draw small num 1
-            const QString smallNum1Path = QString(":/icons/resources/icons/small%1.svg").arg(currentTimeString[2]);
-            const QPixmap smallNum1 = loadSvg(smallNum1Path, QSize(smallNumWidth, smallNumHeight));
             const QPoint smallNum1Offset = bigNum2Offset + QPoint(bigNumWidth + 2, 1);
-            p.drawPixmap(smallNum1Offset, smallNum1);
+            p.drawPixmap(smallNum1Offset, m_glyphAtlas.smallNums[currentTimeString[2].digitValue()]);
 
             // draw small num 2
-            const QString smallNum2Path = QString(":/icons/resources/icons/small%1.svg").arg(currentTimeString[3]);
-            const QPixmap smallNum2 = loadSvg(smallNum2Path, QSize(smallNumWidth, smallNumHeight));
             const QPoint smallNum2Offset = smallNum1Offset + QPoint(smallNumWidth + 1, 0);
-            p.drawPixmap(smallNum2Offset, smallNum2);
+            p.drawPixmap(smallNum2Offset, m_glyphAtlas.smallNums[currentTimeString[3].digitValue()]);
 
             // draw am/pm tips
             const int tips_width = (smallNumWidth * 2 + 2) & ~0x1;
             const int tips_height = tips_width / 2;
 
-            QPixmap tips;
-            if (current.time().hour() > 11)
-                tips = loadSvg(":/icons/resources/icons/tips-pm.svg", QSize(tips_width, tips_height));
-            else
-                tips = loadSvg(":/icons/resources/icons/tips-am.svg", QSize(tips_width, tips_height));
-
+            const QPixmap &tips = current.time().hour() > 11 ? m_glyphAtlas.pmTips : m_glyphAtlas.amTips;
             const QPoint tipsOffset = bigNum2Offset + QPoint(bigNumWidth + 2, bigNumHeight - tips_height);
             p.drawPixmap(tipsOffset, tips);
         } else {
             // draw small num 1
-            const QString smallNum1Path = QString(":/icons/resources/icons/small%1.svg").arg(currentTimeString[2]);
-            const QPixmap smallNum1 = loadSvg(smallNum1Path, QSize(smallNumWidth, smallNumHeight));
             const QPoint smallNum1Offset = bigNum2Offset + QPoint(bigNumWidth + 2, smallNumHeight);
-            p.drawPixmap(smallNum1Offset, smallNum1);
+            p.drawPixmap(smallNum1Offset, m_glyphAtlas.smallNums[currentTimeString[2].digitValue()]);
 
             // draw small num 2
-            const QString smallNum2Path = QString(":/icons/resources/icons/small%1.svg").arg(currentTimeString[3]);
-            const QPixmap smallNum2 = loadSvg(smallNum2Path, QSize(smallNumWidth, smallNumHeight));
             const QPoint smallNum2Offset = smallNum1Offset + QPoint(smallNumWidth + 1, 0);
-            p.drawPixmap(smallNum2Offset, smallNum2);
+            p.drawPixmap(smallNum2Offset, m_glyphAtlas.smallNums[currentTimeString[3].digitValue()]);
         }
     }
 
@@ -225,3 +226,28 @@ const QPixmap DatetimeWidget::loadSvg(const QString &fileName, const QSize size)
 
     return pixmap;
 }
+
+void DatetimeWidget::updateGlyphAtlas(const int perfectIconSize, const qreal ratio)
+{
+    if (m_glyphAtlas.iconSize == perfectIconSize && qFuzzyCompare(m_glyphAtlas.ratio, ratio))
+        return;
+
+    m_glyphAtlas.iconSize = perfectIconSize;
+    m_glyphAtlas.ratio = ratio;
+
+    const int bigNumHeight = perfectIconSize / 2.5;
+    const int bigNumWidth = double(bigNumHeight) * 8 / 18;
+    const int smallNumHeight = bigNumHeight / 2;
+    const int smallNumWidth = double(smallNumHeight) * 5 / 9;
+    const int tips_width = (smallNumWidth * 2 + 2) & ~0x1;
+    const int tips_height = tips_width / 2;
+
+    m_glyphAtlas.background = loadSvg(":/icons/resources/icons/background.svg", QSize(perfectIconSize, perfectIconSize));
+    for (int i(0); i != 10; ++i)
+    {
+        m_glyphAtlas.bigNums[i] = loadSvg(QString(":/icons/resources/icons/big%1.svg").arg(i), QSize(bigNumWidth, bigNumHeight));
+        m_glyphAtlas.smallNums[i] = loadSvg(QString(":/icons/resources/icons/small%1.svg").arg(i), QSize(smallNumWidth, smallNumHeight));
+    }
+    m_glyphAtlas.amTips = loadSvg(":/icons/resources/icons/tips-am.svg", QSize(tips_width, tips_height));
+    m_glyphAtlas.pmTips = loadSvg(":/icons/resources/icons/tips-pm.svg", QSize(tips_width, tips_height));
+}
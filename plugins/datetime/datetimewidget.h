@@ -24,6 +24,7 @@
 
 #include <QWidget>
 #include <QSettings>
+#include <QStaticText>
 
 class DatetimeWidget : public QWidget
 {
@@ -50,8 +51,23 @@ private:
     void mousePressEvent(QMouseEvent *e);
 
     const QPixmap loadSvg(const QString &fileName, const QSize size);
+    void updateGlyphAtlas(const int perfectIconSize, const qreal ratio);
 
 private:
+    // pre-rasterised glyphs of fashion mode, rebuilt only when icon size or ratio changed
+    struct GlyphAtlas
+    {
+        int iconSize = 0;
+        qreal ratio = 0;
+        QPixmap background;
+        QPixmap bigNums[10];
+        QPixmap smallNums[10];
+        QPixmap amTips;
+        QPixmap pmTips;
+    };
+
+    GlyphAtlas m_glyphAtlas;
+    QStaticText m_cachedText;
     QPixmap m_cachedIcon;
     QString m_cachedTime;
     QSettings m_settings;
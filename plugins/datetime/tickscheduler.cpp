@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tickscheduler.h"
+
+#include <QDBusConnection>
+#include <QDebug>
+
+TickScheduler::TickScheduler(QObject *parent)
+    : QObject(parent),
+
+      m_tickTimer(new QTimer(this)),
+      m_secondSubscribers(0)
+{
+    m_tickTimer->setSingleShot(true);
+    m_tickTimer->setTimerType(Qt::PreciseTimer);
+
+    connect(m_tickTimer, &QTimer::timeout, this, &TickScheduler::onTimeout);
+
+    // timers are not reliable across suspend and timezone changes, tick again on wakeup
+    QDBusConnection::systemBus().connect("org.freedesktop.login1", "/org/freedesktop/login1",
+                                         "org.freedesktop.login1.Manager", "PrepareForSleep",
+                                         this, SLOT(onPrepareForSleep(bool)));
+    QDBusConnection::systemBus().connect("org.freedesktop.timedate1", "/org/freedesktop/timedate1",
+                                         "org.freedesktop.DBus.Properties", "PropertiesChanged",
+                                         this, SLOT(onTimedatePropertiesChanged(QDBusMessage)));
+}
+
+void TickScheduler::subscribe(QObject *subscriber, const Granularity granularity)
+{
+    const auto it = m_subscribers.constFind(subscriber);
+    if (it != m_subscribers.constEnd() && it.value() == granularity)
+        return;
+
+    unsubscribe(subscriber);
+
+    m_subscribers.insert(subscriber, granularity);
+    if (granularity == Second)
+        ++m_secondSubscribers;
+
+    connect(subscriber, &QObject::destroyed, this, &TickScheduler::unsubscribe, Qt::UniqueConnection);
+
+    // new subscriber may need a finer granularity
+    schedule();
+}
+
+void TickScheduler::unsubscribe(QObject *subscriber)
+{
+    if (!m_subscribers.contains(subscriber))
+        return;
+
+    if (m_subscribers.take(subscriber) == Second)
+        --m_secondSubscribers;
+
+    disconnect(subscriber, &QObject::destroyed, this, &TickScheduler::unsubscribe);
+
+    schedule();
+}
+
+void TickScheduler::onTimeout()
+{
+    const QDateTime current = QDateTime::currentDateTime();
+
+    if (m_secondSubscribers)
+        emit secondTick(current);
+
+    const QDateTime minute(current.date(), QTime(current.time().hour(), current.time().minute()));
+    if (minute != m_lastMinute)
+    {
+        m_lastMinute = minute;
+        emit minuteTick(current);
+    }
+
+    schedule();
+}
+
+void TickScheduler::onPrepareForSleep(const bool sleep)
+{
+    if (sleep)
+        return m_tickTimer->stop();
+
+    forceTick();
+}
+
+void TickScheduler::onTimedatePropertiesChanged(const QDBusMessage &msg)
+{
+    const QList<QVariant> arguments = msg.arguments();
+    if (arguments.size() != 3)
+        return;
+
+    const QVariantMap changedProps = qdbus_cast<QVariantMap>(arguments.at(1).value<QDBusArgument>());
+    const QStringList invalidatedProps = arguments.at(2).toStringList();
+    if (changedProps.contains("Timezone") || invalidatedProps.contains("Timezone"))
+        forceTick();
+}
+
+void TickScheduler::schedule()
+{
+    if (m_subscribers.isEmpty())
+        return m_tickTimer->stop();
+
+    const QTime current = QTime::currentTime();
+
+    int interval = 1000 - current.msec();
+    if (!m_secondSubscribers)
+        interval += (59 - current.second()) * 1000;
+
+    m_tickTimer->start(interval);
+}
+
+void TickScheduler::forceTick()
+{
+    m_lastMinute = QDateTime();
+
+    onTimeout();
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TICKSCHEDULER_H
+#define TICKSCHEDULER_H
+
+#include <QObject>
+#include <QTimer>
+#include <QDateTime>
+#include <QHash>
+#include <QDBusMessage>
+
+///
+/// \brief The TickScheduler class delivers clock ticks aligned to wall-clock
+/// boundaries. Second ticks are only scheduled while someone subscribes to them,
+/// otherwise the timer wakes up once a minute.
+///
+class TickScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Granularity
+    {
+        Minute,
+        Second,
+    };
+
+    explicit TickScheduler(QObject *parent = 0);
+
+    void subscribe(QObject *subscriber, const Granularity granularity);
+
+public slots:
+    void unsubscribe(QObject *subscriber);
+
+signals:
+    void minuteTick(const QDateTime &current) const;
+    void secondTick(const QDateTime &current) const;
+
+private slots:
+    void onTimeout();
+    void onPrepareForSleep(const bool sleep);
+    void onTimedatePropertiesChanged(const QDBusMessage &msg);
+
+private:
+    void schedule();
+    void forceTick();
+
+private:
+    QTimer *m_tickTimer;
+    QHash<QObject *, Granularity> m_subscribers;
+    int m_secondSubscribers;
+    QDateTime m_lastMinute;
+};
+
+#endif // TICKSCHEDULER_H
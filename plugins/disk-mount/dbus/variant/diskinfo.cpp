@@ -22,6 +22,10 @@
 #include "diskinfo.h"
 
 DiskInfo::DiskInfo()
+    : m_unmountable(false),
+      m_ejectable(false),
+      m_usedSize(0),
+      m_totalSize(0)
 {
 
 }
@@ -35,6 +39,20 @@ void DiskInfo::registerMetaType()
     qDBusRegisterMetaType<DiskInfoList>();
 }
 
+bool DiskInfo::operator==(const DiskInfo &other) const
+{
+    return m_id == other.m_id &&
+           m_name == other.m_name &&
+           m_type == other.m_type &&
+           m_path == other.m_path &&
+           m_mountPoint == other.m_mountPoint &&
+           m_icon == other.m_icon &&
+           m_unmountable == other.m_unmountable &&
+           m_ejectable == other.m_ejectable &&
+           m_usedSize == other.m_usedSize &&
+           m_totalSize == other.m_totalSize;
+}
+
 QDebug operator<<(QDebug debug, const DiskInfo &info)
 {
     debug << info.m_id << info.m_name << info.m_type << info.m_path << info.m_mountPoint << info.m_icon;
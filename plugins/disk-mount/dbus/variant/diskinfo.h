@@ -32,6 +32,9 @@ public:
     DiskInfo();
     static void registerMetaType();
 
+    bool operator==(const DiskInfo &other) const;
+    bool operator!=(const DiskInfo &other) const { return !(*this == other); }
+
     friend QDebug operator<<(QDebug debug, const DiskInfo &info);
     friend QDBusArgument &operator<<(QDBusArgument &args, const DiskInfo &info);
     friend QDataStream &operator<<(QDataStream &args, const DiskInfo &info);
@@ -97,9 +97,15 @@ DiskControlItem::DiskControlItem(const DiskInfo &info, QWidget *parent)
 
 void DiskControlItem::updateInfo(const DiskInfo &info)
 {
+    if (m_diskIcon->pixmap() && m_info == info)
+        return;
+
+    // capacity changes are the most common case, only lookup icon when it really changed
+    if (!m_diskIcon->pixmap() || m_info.m_icon != info.m_icon)
+        m_diskIcon->setPixmap(QIcon::fromTheme(info.m_icon, m_unknowIcon).pixmap(48, 48));
+
     m_info = info;
 
-    m_diskIcon->setPixmap(QIcon::fromTheme(info.m_icon, m_unknowIcon).pixmap(48, 48));
     if (!info.m_name.isEmpty())
         m_diskName->setText(info.m_name);
     else
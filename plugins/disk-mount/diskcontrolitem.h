@@ -38,11 +38,12 @@ class DiskControlItem : public QFrame
 public:
     explicit DiskControlItem(const DiskInfo &info, QWidget *parent = 0);
 
+    void updateInfo(const DiskInfo &info);
+
 signals:
     void requestUnmount(const QString &diskId) const;
 
 private slots:
-    void updateInfo(const DiskInfo &info);
     const QString formatDiskSize(const quint64 size) const;
 
 private:
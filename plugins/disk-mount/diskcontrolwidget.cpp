@@ -30,7 +30,10 @@ DiskControlWidget::DiskControlWidget(QWidget *parent)
       m_centralLayout(new QVBoxLayout),
       m_centralWidget(new QWidget),
 
-      m_diskInter(new DBusDiskMount(this))
+      m_diskInter(new DBusDiskMount(this)),
+
+      m_pendingUnmounts(0),
+      m_failedUnmounts(0)
 {
     m_centralWidget->setLayout(m_centralLayout);
     m_centralWidget->setFixedWidth(WIDTH);
@@ -50,36 +53,73 @@ DiskControlWidget::DiskControlWidget(QWidget *parent)
 
 void DiskControlWidget::unmountAll()
 {
-    for (auto disk : m_diskInfoList)
-        unmountDisk(disk.m_id);
+    // previous request still running
+    if (m_pendingUnmounts)
+        return;
+
+    m_failedUnmounts = 0;
+
+    // issue all unmounts at once, each disk is unmounted only once
+    for (auto it(m_diskItems.cbegin()); it != m_diskItems.cend(); ++it)
+    {
+        QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(m_diskInter->Unmount(it.key()), this);
+        connect(watcher, &QDBusPendingCallWatcher::finished, this, &DiskControlWidget::onUnmountAllReply);
+
+        ++m_pendingUnmounts;
+    }
+
+    // nothing mounted, nothing to wait for
+    if (!m_pendingUnmounts)
+        emit unmountAllFinished(0);
 }
 
 void DiskControlWidget::diskListChanged()
 {
-    DiskInfoList diskList = m_diskInter->diskList();
+    const DiskInfoList diskList = m_diskInter->diskList();
+
+    QStringList mountedDisks;
+    for (const auto &info : diskList)
+        if (!info.m_mountPoint.isEmpty())
+            mountedDisks << info.m_id;
 
-    while (QLayoutItem *item = m_centralLayout->takeAt(0))
+    // remove unplugged disks
+    for (auto it(m_diskItems.begin()); it != m_diskItems.end();)
     {
-        delete item->widget();
-        delete item;
+        if (mountedDisks.contains(it.key()))
+        {
+            ++it;
+            continue;
+        }
+
+        delete it.value();
+        it = m_diskItems.erase(it);
     }
 
-    int mountedCount = 0;
-    for (auto info : diskList)
+    // update existing disks in place, add new disks at their position
+    int index = 0;
+    for (const auto &info : diskList)
     {
         if (info.m_mountPoint.isEmpty())
             continue;
+
+        DiskControlItem *item = m_diskItems.value(info.m_id);
+        if (item)
+            item->updateInfo(info);
         else
-            ++mountedCount;
+        {
+            item = new DiskControlItem(info, this);
 
-        DiskControlItem *item = new DiskControlItem(info, this);
+            connect(item, &DiskControlItem::requestUnmount, this, &DiskControlWidget::unmountDisk);
 
-        connect(item, &DiskControlItem::requestUnmount, this, &DiskControlWidget::unmountDisk);
+            m_centralLayout->insertWidget(index, item);
+            m_diskItems.insert(info.m_id, item);
+        }
 
-        m_centralLayout->addWidget(item);
-        m_diskInfoList.append(info);
+        ++index;
     }
 
+    const int mountedCount = m_diskItems.size();
+
     emit diskCountChanged(mountedCount);
 
     const int contentHeight = mountedCount * 70;
@@ -98,3 +138,19 @@ void DiskControlWidget::unmountFinished(const QString &uuid, const QString &info
 {
     qDebug() << uuid << info;
 }
+
+void DiskControlWidget::onUnmountAllReply(QDBusPendingCallWatcher *w)
+{
+    w->deleteLater();
+
+    if (w->isError())
+    {
+        ++m_failedUnmounts;
+        qWarning() << "unmount failed:" << w->error().message();
+    }
+
+    if (--m_pendingUnmounts)
+        return;
+
+    emit unmountAllFinished(m_failedUnmounts);
+}
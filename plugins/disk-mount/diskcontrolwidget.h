@@ -27,6 +27,8 @@
 #include <QScrollArea>
 #include <QVBoxLayout>
 
+class DiskControlItem;
+
 class DiskControlWidget : public QScrollArea
 {
     Q_OBJECT
@@ -38,18 +40,23 @@ public:
 
 signals:
     void diskCountChanged(const int count) const;
+    void unmountAllFinished(const int failedCount) const;
 
 private slots:
     void diskListChanged();
     void unmountDisk(const QString &diskId) const;
     void unmountFinished(const QString &uuid, const QString &info);
+    void onUnmountAllReply(QDBusPendingCallWatcher *w);
 
 private:
     QVBoxLayout *m_centralLayout;
     QWidget *m_centralWidget;
     DBusDiskMount *m_diskInter;
 
-    DiskInfoList m_diskInfoList;
+    QMap<QString, DiskControlItem *> m_diskItems;
+
+    int m_pendingUnmounts;
+    int m_failedUnmounts;
 };
 
 #endif // DISKCONTROLWIDGET_H
@@ -28,6 +28,7 @@ DiskMountPlugin::DiskMountPlugin(QObject *parent)
     : QObject(parent),
 
       m_pluginAdded(false),
+      m_unmounting(false),
 
       m_tipsLabel(new QLabel),
       m_diskPluginItem(new DiskPluginItem),
@@ -64,6 +65,13 @@ QWidget *DiskMountPlugin::itemWidget(const QString &itemKey)
     return m_diskPluginItem;
 }
 
+bool DiskMountPlugin::itemHoverEffect(const QString &itemKey)
+{
+    Q_UNUSED(itemKey);
+
+    return true;
+}
+
 QWidget *DiskMountPlugin::itemTipsWidget(const QString &itemKey)
 {
     Q_UNUSED(itemKey);
@@ -94,7 +102,7 @@ const QString DiskMountPlugin::itemContextMenu(const QString &itemKey)
     QMap<QString, QVariant> unmountAll;
     unmountAll["itemId"] = UNMOUNT_ALL;
     unmountAll["itemText"] = tr("Unmount all");
-    unmountAll["isActive"] = true;
+    unmountAll["isActive"] = !m_unmounting;
     items.push_back(unmountAll);
 
     QMap<QString, QVariant> menu;
@@ -112,8 +120,11 @@ void DiskMountPlugin::invokedMenuItem(const QString &itemKey, const QString &men
 
     if (menuId == OPEN)
         QProcess::startDetached("gvfs-open", QStringList() << "computer://");
-    else if (menuId == UNMOUNT_ALL)
+    else if (menuId == UNMOUNT_ALL && !m_unmounting)
+    {
+        m_unmounting = true;
         m_diskControlApplet->unmountAll();
+    }
 }
 
 void DiskMountPlugin::initCompoments()
@@ -123,6 +134,7 @@ void DiskMountPlugin::initCompoments()
     m_diskControlApplet->setVisible(false);
 
     connect(m_diskControlApplet, &DiskControlWidget::diskCountChanged, this, &DiskMountPlugin::diskCountChanged);
+    connect(m_diskControlApplet, &DiskControlWidget::unmountAllFinished, this, &DiskMountPlugin::unmountAllFinished);
 }
 
 void DiskMountPlugin::displayModeChanged(const Dock::DisplayMode mode)
@@ -142,3 +154,12 @@ void DiskMountPlugin::diskCountChanged(const int count)
     else
         m_proxyInter->itemRemoved(this, QString());
 }
+
+void DiskMountPlugin::unmountAllFinished(const int failedCount)
+{
+    // each failure is already reported, disks that did unmount leave
+    // the list through DiskListChanged
+    Q_UNUSED(failedCount);
+
+    m_unmounting = false;
+}
@@ -41,6 +41,7 @@ public:
     void init(PluginProxyInterface *proxyInter);
 
     QWidget *itemWidget(const QString &itemKey);
+    Q_INVOKABLE bool itemHoverEffect(const QString &itemKey);
     QWidget *itemTipsWidget(const QString &itemKey);
     QWidget *itemPopupApplet(const QString &itemKey);
 
@@ -54,9 +55,11 @@ private:
 
 private slots:
     void diskCountChanged(const int count);
+    void unmountAllFinished(const int failedCount);
 
 private:
     bool m_pluginAdded;
+    bool m_unmounting;
 
     QLabel *m_tipsLabel;
     DiskPluginItem *m_diskPluginItem;
@@ -54,6 +54,13 @@ QWidget* KeyboardPlugin::itemWidget(const QString &itemKey)
     return nullptr;
 }
 
+bool KeyboardPlugin::itemHoverEffect(const QString &itemKey)
+{
+    Q_UNUSED(itemKey);
+
+    return true;
+}
+
 QWidget* KeyboardPlugin::itemTipsWidget(const QString &itemKey)
 {
     Q_UNUSED(itemKey);
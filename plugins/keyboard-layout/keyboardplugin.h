@@ -38,6 +38,7 @@ public:
     void init(PluginProxyInterface *proxyInter) override;
 
     QWidget *itemWidget(const QString &itemKey) override;
+    Q_INVOKABLE bool itemHoverEffect(const QString &itemKey);
     QWidget *itemTipsWidget(const QString &itemKey) override;
 
 private:
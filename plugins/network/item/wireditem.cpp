@@ -22,6 +22,7 @@
 #include "constants.h"
 #include "wireditem.h"
 #include "util/imageutil.h"
+#include "util/iconframecache.h"
 
 #include <QPainter>
 #include <QMouseEvent>
@@ -32,12 +33,13 @@ WiredItem::WiredItem(const QString &path)
     : DeviceItem(path),
 
       m_connected(false),
+      m_animating(false),
       m_itemTips(new QLabel(this)),
       m_delayTimer(new QTimer(this))
 {
 //    QIcon::setThemeName("deepin");
 
-    m_delayTimer->setSingleShot(false);
+    m_delayTimer->setSingleShot(true);
     m_delayTimer->setInterval(200);
 
     m_itemTips->setObjectName("wired-" + path);
@@ -46,6 +48,7 @@ WiredItem::WiredItem(const QString &path)
                               "padding:0px 3px;");
 
     connect(m_delayTimer, &QTimer::timeout, this, &WiredItem::reloadIcon);
+    connect(IconFrameCache::instance(), &IconFrameCache::frameChanged, this, &WiredItem::animationFrameChanged);
 
     connect(m_networkManager, &NetworkManager::globalNetworkStateChanged, m_delayTimer, static_cast<void (QTimer::*)()>(&QTimer::start));
     connect(m_networkManager, &NetworkManager::deviceChanged, this, &WiredItem::deviceStateChanged);
@@ -134,6 +137,9 @@ void WiredItem::reloadIcon()
     Q_ASSERT(sender() == m_delayTimer);
 
     const Dock::DisplayMode displayMode = qApp->property(PROP_DISPLAY_MODE).value<Dock::DisplayMode>();
+    const auto ratio = qApp->devicePixelRatio();
+    const int size = displayMode == Dock::Efficient ? 16 : std::min(width(), height()) * 0.8;
+    IconFrameCache *cache = IconFrameCache::instance();
 
     QString iconName = "network-";
     if (!m_connected)
@@ -148,11 +154,9 @@ void WiredItem::reloadIcon()
         NetworkManager::GlobalNetworkState gState = m_networkManager->globalNetworkState();
 
         if (gState == NetworkManager::Connecting) {
-            m_delayTimer->start();
-            const quint64 index = QDateTime::currentMSecsSinceEpoch() / 200;
-            const int num = (index % 5) + 1;
-            m_icon = QPixmap(QString(":/wired/resources/wired/network-wired-symbolic-connecting%1.svg").arg(num));
-            update();
+            m_animating = true;
+            cache->startAnimation(this);
+            animationFrameChanged(cache->frameIndex());
             return;
         }
 
@@ -162,15 +166,27 @@ void WiredItem::reloadIcon()
             iconName.append("idle");
     }
 
-    m_delayTimer->stop();
+    m_animating = false;
+    cache->stopAnimation(this);
 
     if (displayMode == Dock::Efficient)
         iconName.append("-symbolic");
 
+    m_icon = cache->icon(iconName, QString(), size * ratio, ratio);
+    update();
+}
+
+void WiredItem::animationFrameChanged(const int index)
+{
+    if (!m_animating)
+        return;
+
+    const Dock::DisplayMode displayMode = qApp->property(PROP_DISPLAY_MODE).value<Dock::DisplayMode>();
     const auto ratio = qApp->devicePixelRatio();
     const int size = displayMode == Dock::Efficient ? 16 : std::min(width(), height()) * 0.8;
-    m_icon = QIcon::fromTheme(iconName).pixmap(size * ratio, size * ratio);
-    m_icon.setDevicePixelRatio(ratio);
+    const QString name = QString("network-wired-symbolic-connecting%1").arg(index + 1);
+
+    m_icon = IconFrameCache::instance()->icon(name, QString(":/wired/resources/wired/%1.svg").arg(name), size * ratio, ratio);
     update();
 }
 
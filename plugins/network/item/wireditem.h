@@ -48,11 +48,13 @@ protected:
 private slots:
     void refreshIcon() override;
     void reloadIcon();
+    void animationFrameChanged(const int index);
     void activeConnectionChanged();
     void deviceStateChanged(const NetworkDevice &device);
 
 private:
     bool m_connected;
+    bool m_animating;
     QPixmap m_icon;
 
     QLabel *m_itemTips;
@@ -21,6 +21,7 @@
 
 #include "wirelessitem.h"
 #include "util/imageutil.h"
+#include "util/iconframecache.h"
 
 #include <QPainter>
 #include <QMouseEvent>
@@ -29,21 +30,21 @@
 WirelessItem::WirelessItem(const QString &path)
     : DeviceItem(path),
 
-      m_refershTimer(new QTimer(this)),
+      m_animating(false),
       m_wirelessApplet(new QWidget),
       m_wirelessPopup(new QLabel),
       m_APList(nullptr)
 {
-    m_refershTimer->setSingleShot(false);
-    m_refershTimer->setInterval(100);
-
     m_wirelessApplet->setVisible(false);
     m_wirelessPopup->setObjectName("wireless-" + m_devicePath);
     m_wirelessPopup->setVisible(false);
     m_wirelessPopup->setStyleSheet("color:white;"
                                    "padding: 0px 3px;");
 
-    connect(m_refershTimer, &QTimer::timeout, this, static_cast<void (WirelessItem::*)()>(&WirelessItem::update));
+    connect(IconFrameCache::instance(), &IconFrameCache::frameChanged, this, [=] {
+        if (m_animating)
+            update();
+    });
     QMetaObject::invokeMethod(this, "init", Qt::QueuedConnection);
 }
 
@@ -106,26 +107,17 @@ void WirelessItem::paintEvent(QPaintEvent *e)
 
     const auto ratio = qApp->devicePixelRatio();
     const int iconSize = displayMode == Dock::Fashion ? std::min(width(), height()) * 0.8 : 16;
-    QPixmap pixmap = iconPix(displayMode, iconSize * ratio);
-    pixmap.setDevicePixelRatio(ratio);
+    const QPixmap pixmap = iconPix(displayMode, iconSize * ratio);
 
     QPainter painter(this);
     if (displayMode == Dock::Fashion)
     {
-        QPixmap pixmap = backgroundPix(iconSize * ratio);
-        pixmap.setDevicePixelRatio(ratio);
+        const QPixmap pixmap = backgroundPix(iconSize * ratio);
         painter.drawPixmap(rect().center() - pixmap.rect().center() / ratio, pixmap);
     }
     painter.drawPixmap(rect().center() - pixmap.rect().center() / ratio, pixmap);
 }
 
-void WirelessItem::resizeEvent(QResizeEvent *e)
-{
-    DeviceItem::resizeEvent(e);
-
-    m_icons.clear();
-}
-
 void WirelessItem::mousePressEvent(QMouseEvent *e)
 {
     if (e->button() != Qt::RightButton)
@@ -149,22 +141,18 @@ const QPixmap WirelessItem::iconPix(const Dock::DisplayMode displayMode, const i
     if (state <= NetworkDevice::Disconnected)
     {
         type = "disconnect";
-        m_refershTimer->stop();
+        setAnimating(false);
+    }
+    else if (state != NetworkDevice::Activated)
+    {
+        // connecting, step through the strength icons
+        type = QString::number(IconFrameCache::instance()->frameIndex() * 20);
+        setAnimating(true);
     }
     else
     {
-        int strength = 0;
-        if (state == NetworkDevice::Activated)
-        {
-            strength = m_APList->activeAPStrgength();
-            m_refershTimer->stop();
-        }
-        else
-        {
-            strength = QTime::currentTime().msec() / 10 % 100;
-            if (!m_refershTimer->isActive())
-                m_refershTimer->start();
-        }
+        const int strength = m_APList->activeAPStrgength();
+        setAnimating(false);
 
         if (strength == 100)
             type = "80";
@@ -188,11 +176,20 @@ const QPixmap WirelessItem::backgroundPix(const int size)
 
 const QPixmap WirelessItem::cachedPix(const QString &key, const int size)
 {
-    if (!m_icons.contains(key))
-        m_icons.insert(key, QIcon::fromTheme(key,
-                                             QIcon(":/wireless/resources/wireless/" + key + ".svg")).pixmap(size));
+    return IconFrameCache::instance()->icon(key, ":/wireless/resources/wireless/" + key + ".svg", size, qApp->devicePixelRatio());
+}
 
-    return m_icons.value(key);
+void WirelessItem::setAnimating(const bool animating)
+{
+    if (m_animating == animating)
+        return;
+
+    m_animating = animating;
+
+    if (animating)
+        IconFrameCache::instance()->startAnimation(this);
+    else
+        IconFrameCache::instance()->stopAnimation(this);
 }
 
 void WirelessItem::init()
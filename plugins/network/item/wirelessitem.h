@@ -27,7 +27,6 @@
 #include "deviceitem.h"
 #include "applet/wirelessapplet.h"
 
-#include <QHash>
 
 class WirelessItem : public DeviceItem
 {
@@ -45,13 +44,13 @@ public:
 protected:
     bool eventFilter(QObject *o, QEvent *e);
     void paintEvent(QPaintEvent *e);
-    void resizeEvent(QResizeEvent *e);
     void mousePressEvent(QMouseEvent *e);
 
 private:
     const QPixmap iconPix(const Dock::DisplayMode displayMode, const int size);
     const QPixmap backgroundPix(const int size);
     const QPixmap cachedPix(const QString &key, const int size);
+    void setAnimating(const bool animating);
 
 private slots:
     void init();
@@ -59,9 +58,8 @@ private slots:
     void refreshIcon();
 
 private:
-    QHash<QString, QPixmap> m_icons;
+    bool m_animating;
 
-    QTimer *m_refershTimer;
     QWidget *m_wirelessApplet;
     QLabel *m_wirelessPopup;
     WirelessList *m_APList;
@@ -22,6 +22,7 @@
 #include "networkplugin.h"
 #include "item/wireditem.h"
 #include "item/wirelessitem.h"
+#include "util/iconframecache.h"
 
 #define WIRED_ITEM      "wired"
 #define WIRELESS_ITEM   "wireless"
@@ -82,6 +83,16 @@ void NetworkPlugin::refershIcon(const QString &itemKey)
         item->refreshIcon();
 }
 
+void NetworkPlugin::displayModeChanged(const Dock::DisplayMode displayMode)
+{
+    Q_UNUSED(displayMode);
+
+    IconFrameCache::instance()->invalidate();
+
+    for (auto *item : m_deviceItemList)
+        item->refreshIcon();
+}
+
 void NetworkPlugin::pluginStateSwitched()
 {
     m_settings.setValue(STATE_KEY, !m_settings.value(STATE_KEY, true).toBool());
@@ -125,6 +136,13 @@ QWidget *NetworkPlugin::itemWidget(const QString &itemKey)
     return nullptr;
 }
 
+bool NetworkPlugin::itemHoverEffect(const QString &itemKey)
+{
+    Q_UNUSED(itemKey);
+
+    return true;
+}
+
 QWidget *NetworkPlugin::itemTipsWidget(const QString &itemKey)
 {
     for (auto deviceItem : m_deviceItemList)
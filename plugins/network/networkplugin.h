@@ -42,12 +42,14 @@ public:
     void init(PluginProxyInterface *proxyInter);
     void invokedMenuItem(const QString &itemKey, const QString &menuId, const bool checked);
     void refershIcon(const QString &itemKey);
+    void displayModeChanged(const Dock::DisplayMode displayMode) override;
     void pluginStateSwitched();
     bool pluginIsAllowDisable() { return true; }
     bool pluginIsDisable();
     const QString itemCommand(const QString &itemKey);
     const QString itemContextMenu(const QString &itemKey);
     QWidget *itemWidget(const QString &itemKey);
+    Q_INVOKABLE bool itemHoverEffect(const QString &itemKey);
     QWidget *itemTipsWidget(const QString &itemKey);
     QWidget *itemPopupApplet(const QString &itemKey);
 
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "iconframecache.h"
+
+#include <QIcon>
+#include <QTimer>
+#include <QDebug>
+
+#include <algorithm>
+
+// in kilobytes, every connecting frame of a few sizes at hidpi
+#define CACHE_COST_LIMIT    2048
+
+IconFrameCache *IconFrameCache::instance()
+{
+    static IconFrameCache *INSTANCE = new IconFrameCache;
+
+    return INSTANCE;
+}
+
+IconFrameCache::IconFrameCache(QObject *parent)
+    : QObject(parent),
+      m_frameIndex(0),
+      m_rasterizeCount(0),
+      m_animationTimer(new QTimer(this))
+{
+    m_pixmaps.setMaxCost(CACHE_COST_LIMIT);
+    m_animationTimer->setInterval(200);
+
+    connect(m_animationTimer, &QTimer::timeout, this, &IconFrameCache::nextFrame);
+}
+
+const QPixmap IconFrameCache::icon(const QString &name, const QString &fallback, const int size, const qreal ratio)
+{
+    const QString key = QString("%1@%2@%3").arg(name).arg(size).arg(ratio);
+
+    const QPixmap *cached = m_pixmaps.object(key);
+    if (cached)
+        return *cached;
+
+    QPixmap pixmap = fallback.isEmpty() ? QIcon::fromTheme(name).pixmap(size)
+                                        : QIcon::fromTheme(name, QIcon(fallback)).pixmap(size);
+    pixmap.setDevicePixelRatio(ratio);
+    m_pixmaps.insert(key, new QPixmap(pixmap), std::max(1, pixmap.width() * pixmap.height() * pixmap.depth() / 8 / 1024));
+    ++m_rasterizeCount;
+
+    return pixmap;
+}
+
+void IconFrameCache::startAnimation(QObject *client)
+{
+    if (m_animationClients.contains(client))
+        return;
+
+    m_animationClients.insert(client);
+    connect(client, &QObject::destroyed, this, &IconFrameCache::stopAnimation, Qt::UniqueConnection);
+
+    if (!m_animationTimer->isActive())
+        m_animationTimer->start();
+}
+
+void IconFrameCache::stopAnimation(QObject *client)
+{
+    if (!m_animationClients.remove(client))
+        return;
+
+    if (m_animationClients.isEmpty())
+        m_animationTimer->stop();
+}
+
+void IconFrameCache::invalidate()
+{
+    m_pixmaps.clear();
+}
+
+void IconFrameCache::nextFrame()
+{
+    m_frameIndex = (m_frameIndex + 1) % FrameCount;
+
+    emit frameChanged(m_frameIndex);
+}
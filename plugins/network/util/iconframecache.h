@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ICONFRAMECACHE_H
+#define ICONFRAMECACHE_H
+
+#include <QObject>
+#include <QPixmap>
+#include <QCache>
+#include <QSet>
+
+class QTimer;
+
+///
+/// \brief The IconFrameCache class rasterizes network icons once per pixel
+/// size and device pixel ratio, and drives the connecting animation of all
+/// device items from one shared timer. pixmaps are kept up to a fixed
+/// budget, so sizes passed through during a panel resize age out.
+///
+class IconFrameCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    static const int FrameCount = 5;
+
+    static IconFrameCache *instance();
+
+    const QPixmap icon(const QString &name, const QString &fallback, const int size, const qreal ratio);
+    int frameIndex() const { return m_frameIndex; }
+    int rasterizeCount() const { return m_rasterizeCount; }
+    bool isAnimating(QObject *client) const { return m_animationClients.contains(client); }
+
+    void startAnimation(QObject *client);
+
+public slots:
+    void stopAnimation(QObject *client);
+    void invalidate();
+
+signals:
+    void frameChanged(const int index) const;
+
+private:
+    explicit IconFrameCache(QObject *parent = nullptr);
+
+private slots:
+    void nextFrame();
+
+private:
+    int m_frameIndex;
+    int m_rasterizeCount;
+    QTimer *m_animationTimer;
+    QSet<QObject *> m_animationClients;
+    QCache<QString, QPixmap> m_pixmaps;
+};
+
+#endif // ICONFRAMECACHE_H
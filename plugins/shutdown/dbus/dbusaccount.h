@@ -86,6 +86,10 @@ public:
     Q_PROPERTY(QStringList UserList READ userList)
     inline QStringList userList() const
     { return qvariant_cast< QStringList >(property("UserList")); }
+
+Q_SIGNALS: // SIGNALS
+    void UserAdded(const QString &in0);
+    void UserDeleted(const QString &in0);
 };
 
 //namespace com {
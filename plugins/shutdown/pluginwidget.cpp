@@ -26,14 +26,13 @@
 #include <QMouseEvent>
 #include <QApplication>
 
-PluginWidget::PluginWidget(QWidget *parent)
+PluginWidget::PluginWidget(PowerState *powerState, QWidget *parent)
     : QWidget(parent),
       m_hover(false),
-      m_powerInter(new DBusPower(this))
+      m_powerState(powerState),
+      m_iconCacheRatio(0)
 {
-    connect(m_powerInter, &DBusPower::BatteryPercentageChanged, this, static_cast<void (PluginWidget::*)()>(&PluginWidget::update));
-    connect(m_powerInter, &DBusPower::BatteryStateChanged, this, static_cast<void (PluginWidget::*)()>(&PluginWidget::update));
-    connect(m_powerInter, &DBusPower::OnBatteryChanged, this, static_cast<void (PluginWidget::*)()>(&PluginWidget::update));
+    connect(m_powerState, &PowerState::batteryChanged, this, static_cast<void (PluginWidget::*)()>(&PluginWidget::update));
 }
 
 QSize PluginWidget::sizeHint() const
@@ -52,44 +51,42 @@ void PluginWidget::paintEvent(QPaintEvent *e)
 
         if (displayMode == Dock::Efficient)
         {
-            pixmap = loadSvg(":/icons/resources/icons/normal.svg", QSize(16, 16));
+            pixmap = cachedSvg(":/icons/resources/icons/normal.svg", QSize(16, 16));
             break;
         }
 
         const int iconSize = std::min(width(), height()) * 0.8;
         const QSize size = QSize(iconSize, iconSize);
-        const BatteryPercentageMap percentageData = m_powerInter->batteryPercentage();
-        if (percentageData.isEmpty())
+        if (!m_powerState->hasBattery())
         {
-            pixmap = loadSvg(":/icons/resources/icons/fashion.svg", size);
+            pixmap = cachedSvg(":/icons/resources/icons/fashion.svg", size);
             break;
         }
 
-        const BatteryStateMap stateData = m_powerInter->batteryState();
-        if (stateData.isEmpty())
+        if (!m_powerState->hasBatteryState())
         {
-            pixmap = loadSvg(":/icons/resources/icons/battery_unknow.svg", size);
+            pixmap = cachedSvg(":/icons/resources/icons/battery_unknow.svg", size);
             break;
         }
 
         // battery full, charged
-        if (stateData.value("Display") == 4)
+        if (m_powerState->batteryState() == 4)
         {
             if (!m_hover)
-                pixmap = loadSvg(":/icons/resources/icons/battery_plugged.svg", size);
+                pixmap = cachedSvg(":/icons/resources/icons/battery_plugged.svg", size);
             else
-                pixmap = loadSvg(":/icons/resources/icons/battery_10.svg", size);
+                pixmap = cachedSvg(":/icons/resources/icons/battery_10.svg", size);
             break;
         }
 
-        const bool onBattery = m_powerInter->onBattery();
-        const uint percentage = qMin(100.0, qMax(0.0, percentageData.value("Display")));
+        const bool onBattery = m_powerState->onBattery();
+        const uint percentage = m_powerState->percentage();
         const int percent = std::round(percentage / 10.0) * 10;
         const int imageNumber = (percent / 10) & ~0x1;
         const QString image = QString(":/icons/resources/icons/battery_%1%2.svg").arg(imageNumber)
                                                                                  .arg(m_hover || onBattery ? "" : "_plugged");
 
-        pixmap = loadSvg(image, size);
+        pixmap = cachedSvg(image, size);
     } while (false);
 
     QPainter painter(this);
@@ -140,3 +137,29 @@ const QPixmap PluginWidget::loadSvg(const QString &fileName, const QSize &size)
 
     return pixmap;
 }
+
+const QPixmap &PluginWidget::cachedSvg(const QString &fileName, const QSize &size)
+{
+    const auto ratio = qApp->devicePixelRatio();
+
+    // fashion icons depend on widget size, render all battery levels once per size
+    if (size != QSize(16, 16) && (m_iconCacheSize != size || !qFuzzyCompare(m_iconCacheRatio, ratio)))
+    {
+        m_iconCache.clear();
+        m_iconCacheSize = size;
+        m_iconCacheRatio = ratio;
+
+        for (int i(0); i <= 10; i += 2)
+        {
+            const QString image = QString(":/icons/resources/icons/battery_%1%2.svg").arg(i);
+            m_iconCache.insert(image.arg(""), loadSvg(image.arg(""), size));
+            m_iconCache.insert(image.arg("_plugged"), loadSvg(image.arg("_plugged"), size));
+        }
+    }
+
+    auto it = m_iconCache.find(fileName);
+    if (it == m_iconCache.end() || !qFuzzyCompare(it->devicePixelRatioF(), ratio) || it->size() != size * ratio)
+        it = m_iconCache.insert(fileName, loadSvg(fileName, size));
+
+    return it.value();
+}
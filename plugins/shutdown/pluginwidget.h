@@ -23,7 +23,7 @@
 #define PLUGINWIDGET_H
 
 #include "constants.h"
-#include "dbus/dbuspower.h"
+#include "powerstate.h"
 
 #include <QWidget>
 #include <QTimer>
@@ -35,7 +35,7 @@ class PluginWidget : public QWidget
     Q_OBJECT
 
 public:
-    explicit PluginWidget(QWidget *parent = 0);
+    explicit PluginWidget(PowerState *powerState, QWidget *parent = 0);
 
 signals:
     void requestContextMenu(const QString &itemKey) const;
@@ -49,6 +49,7 @@ protected:
 
 private:
     const QPixmap loadSvg(const QString &fileName, const QSize &size) const;
+    const QPixmap &cachedSvg(const QString &fileName, const QSize &size);
 
 private:
     void refershIconPixmap();
@@ -57,7 +58,12 @@ private:
     bool m_hover;
     Dock::DisplayMode m_displayMode;
 
-    DBusPower *m_powerInter;
+    PowerState *m_powerState;
+
+    // rendered icons of current size and ratio
+    QMap<QString, QPixmap> m_iconCache;
+    QSize m_iconCacheSize;
+    qreal m_iconCacheRatio;
 };
 
 #endif // PLUGINWIDGET_H
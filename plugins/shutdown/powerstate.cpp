@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "powerstate.h"
+
+PowerState::PowerState(QObject *parent)
+    : QObject(parent),
+
+      m_powerInter(new DBusPower(this)),
+      m_accountInter(new DBusAccount(this)),
+
+      m_onBattery(false),
+      m_userCount(0)
+{
+    connect(m_powerInter, &DBusPower::BatteryPercentageChanged, this, &PowerState::onBatteryPercentageChanged);
+    connect(m_powerInter, &DBusPower::BatteryStateChanged, this, &PowerState::onBatteryStateChanged);
+    connect(m_powerInter, &DBusPower::OnBatteryChanged, this, &PowerState::onOnBatteryChanged);
+    connect(m_accountInter, &DBusAccount::UserAdded, this, &PowerState::refreshUserCount);
+    connect(m_accountInter, &DBusAccount::UserDeleted, this, &PowerState::refreshUserCount);
+
+    refreshAll();
+}
+
+uint PowerState::percentage() const
+{
+    return qMin(100.0, qMax(0.0, m_batteryPercentage.value("Display")));
+}
+
+void PowerState::refreshAll()
+{
+    m_batteryPercentage = m_powerInter->batteryPercentage();
+    m_batteryState = m_powerInter->batteryState();
+    m_onBattery = m_powerInter->onBattery();
+
+    refreshUserCount();
+
+    emit batteryChanged();
+}
+
+void PowerState::onBatteryPercentageChanged()
+{
+    m_batteryPercentage = m_powerInter->batteryPercentage();
+
+    emit batteryChanged();
+}
+
+void PowerState::onBatteryStateChanged()
+{
+    m_batteryState = m_powerInter->batteryState();
+
+    emit batteryChanged();
+}
+
+void PowerState::onOnBatteryChanged()
+{
+    m_onBattery = m_powerInter->onBattery();
+
+    emit batteryChanged();
+}
+
+void PowerState::refreshUserCount()
+{
+    QDBusMessage msg = QDBusMessage::createMethodCall(m_accountInter->service(), m_accountInter->path(),
+                                                      "org.freedesktop.DBus.Properties", "Get");
+    msg << QString(DBusAccount::staticInterfaceName()) << QString("UserList");
+
+    QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(m_accountInter->connection().asyncCall(msg), this);
+    connect(watcher, &QDBusPendingCallWatcher::finished, this, &PowerState::onUserListFetched);
+}
+
+void PowerState::onUserListFetched(QDBusPendingCallWatcher *w)
+{
+    w->deleteLater();
+
+    QDBusPendingReply<QDBusVariant> reply = *w;
+    if (reply.isError())
+        return;
+
+    const int userCount = reply.value().variant().toStringList().count();
+    if (userCount == m_userCount)
+        return;
+
+    m_userCount = userCount;
+
+    emit userCountChanged();
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef POWERSTATE_H
+#define POWERSTATE_H
+
+#include "dbus/dbuspower.h"
+#include "dbus/dbusaccount.h"
+
+#include <QObject>
+
+///
+/// \brief The PowerState class keeps a local snapshot of battery and account state,
+/// updated from change signals, so painting and menu building never touch the bus.
+///
+class PowerState : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit PowerState(QObject *parent = 0);
+
+    bool isValid() const { return m_powerInter->isValid(); }
+    bool hasBattery() const { return !m_batteryPercentage.isEmpty(); }
+    bool hasBatteryState() const { return !m_batteryState.isEmpty(); }
+    bool onBattery() const { return m_onBattery; }
+    uint percentage() const;
+    quint32 batteryState() const { return m_batteryState.value("Display"); }
+    int userCount() const { return m_userCount; }
+
+signals:
+    void batteryChanged() const;
+    void userCountChanged() const;
+
+public slots:
+    void refreshAll();
+
+private slots:
+    void onBatteryPercentageChanged();
+    void onBatteryStateChanged();
+    void onOnBatteryChanged();
+    void refreshUserCount();
+    void onUserListFetched(QDBusPendingCallWatcher *w);
+
+private:
+    DBusPower *m_powerInter;
+    DBusAccount *m_accountInter;
+
+    BatteryPercentageMap m_batteryPercentage;
+    BatteryStateMap m_batteryState;
+    bool m_onBattery;
+    int m_userCount;
+};
+
+#endif // POWERSTATE_H
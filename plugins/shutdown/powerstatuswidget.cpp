@@ -25,16 +25,15 @@
 #include <QIcon>
 #include <QMouseEvent>
 
-PowerStatusWidget::PowerStatusWidget(QWidget *parent)
+PowerStatusWidget::PowerStatusWidget(PowerState *powerState, QWidget *parent)
     : QWidget(parent),
 
-      m_powerInter(new DBusPower(this))
+      m_powerState(powerState),
+      m_iconCacheRatio(0)
 {
 //    QIcon::setThemeName("deepin");
 
-    connect(m_powerInter, &DBusPower::BatteryPercentageChanged, this, static_cast<void (PowerStatusWidget::*)()>(&PowerStatusWidget::update));
-    connect(m_powerInter, &DBusPower::BatteryStateChanged, this, static_cast<void (PowerStatusWidget::*)()>(&PowerStatusWidget::update));
-    connect(m_powerInter, &DBusPower::OnBatteryChanged, this, static_cast<void (PowerStatusWidget::*)()>(&PowerStatusWidget::update));
+    connect(m_powerState, &PowerState::batteryChanged, this, static_cast<void (PowerStatusWidget::*)()>(&PowerStatusWidget::update));
 }
 
 QSize PowerStatusWidget::sizeHint() const
@@ -46,7 +45,7 @@ void PowerStatusWidget::paintEvent(QPaintEvent *e)
 {
     Q_UNUSED(e);
 
-    const QPixmap icon = getBatteryIcon();
+    const QPixmap &icon = getBatteryIcon();
     const auto ratio = devicePixelRatioF();
 
     QPainter painter(this);
@@ -68,36 +67,50 @@ void PowerStatusWidget::mousePressEvent(QMouseEvent *e)
     return QWidget::mousePressEvent(e);
 }
 
-QPixmap PowerStatusWidget::getBatteryIcon()
+const QPixmap &PowerStatusWidget::getBatteryIcon()
 {
-    const BatteryPercentageMap data = m_powerInter->batteryPercentage();
-    const uint value = qMin(100.0, qMax(0.0, data.value("Display")));
-    const int percentage = std::round(value);
-    const bool plugged = !m_powerInter->onBattery();
-
-    QString percentageStr;
-    if (percentage < 10 && percentage >= 0) {
-        percentageStr = "000";
-    } else if (percentage < 30) {
-        percentageStr = "020";
-    } else if (percentage < 50) {
-        percentageStr = "040";
-    } else if (percentage < 70) {
-        percentageStr = "060";
-    } else if (percentage < 90) {
-        percentageStr = "080";
-    } else if (percentage <= 100){
-        percentageStr = "100";
-    } else {
-        percentageStr = "000";
-    }
+    const auto ratio = devicePixelRatioF();
+    if (!qFuzzyCompare(m_iconCacheRatio, ratio))
+        refreshIconCache();
+
+    const int percentage = m_powerState->percentage();
+    const bool plugged = !m_powerState->onBattery();
+
+    int level;
+    if (percentage < 10)
+        level = 0;
+    else if (percentage < 30)
+        level = 1;
+    else if (percentage < 50)
+        level = 2;
+    else if (percentage < 70)
+        level = 3;
+    else if (percentage < 90)
+        level = 4;
+    else
+        level = 5;
+
+    return m_batteryIcons[level][plugged];
+}
 
-    const QString iconStr = QString("battery-%1-%2")
-                                .arg(percentageStr)
-                                .arg(plugged ? "plugged-symbolic" : "symbolic");
+void PowerStatusWidget::refreshIconCache()
+{
     const auto ratio = devicePixelRatioF();
-    QPixmap pix = QIcon::fromTheme(iconStr).pixmap(QSize(16, 16) * ratio);
-    pix.setDevicePixelRatio(ratio);
+    const QStringList levels = { "000", "020", "040", "060", "080", "100" };
+
+    for (int i(0); i != levels.size(); ++i)
+    {
+        for (int plugged(0); plugged != 2; ++plugged)
+        {
+            const QString iconStr = QString("battery-%1-%2")
+                                        .arg(levels[i])
+                                        .arg(plugged ? "plugged-symbolic" : "symbolic");
+            QPixmap pix = QIcon::fromTheme(iconStr).pixmap(QSize(16, 16) * ratio);
+            pix.setDevicePixelRatio(ratio);
+
+            m_batteryIcons[i][plugged] = pix;
+        }
+    }
 
-    return pix;
+    m_iconCacheRatio = ratio;
 }
@@ -22,7 +22,7 @@
 #ifndef POWERSTATUSWIDGET_H
 #define POWERSTATUSWIDGET_H
 
-#include "dbus/dbuspower.h"
+#include "powerstate.h"
 
 #include <QWidget>
 
@@ -33,7 +33,7 @@ class PowerStatusWidget : public QWidget
     Q_OBJECT
 
 public:
-    explicit PowerStatusWidget(QWidget *parent = 0);
+    explicit PowerStatusWidget(PowerState *powerState, QWidget *parent = 0);
 
 signals:
     void requestContextMenu(const QString &itemKey) const;
@@ -44,10 +44,15 @@ protected:
     void mousePressEvent(QMouseEvent *e);
 
 private:
-    QPixmap getBatteryIcon();
+    const QPixmap &getBatteryIcon();
+    void refreshIconCache();
 
 private:
-    DBusPower *m_powerInter;
+    PowerState *m_powerState;
+
+    // battery icons of six levels, unplugged and plugged
+    QPixmap m_batteryIcons[6][2];
+    qreal m_iconCacheRatio;
 };
 
 #endif // POWERSTATUSWIDGET_H
@@ -20,7 +20,6 @@
  */
 
 #include "shutdownplugin.h"
-#include "dbus/dbusaccount.h"
 
 #include <QIcon>
 #include <QSettings>
@@ -31,11 +30,10 @@ ShutdownPlugin::ShutdownPlugin(QObject *parent)
     : QObject(parent),
 
       m_settings("deepin", "dde-dock-power"),
-      m_shutdownWidget(new PluginWidget),
-      m_powerStatusWidget(new PowerStatusWidget),
-      m_tipsLabel(new QLabel),
-
-      m_powerInter(new DBusPower(this))
+      m_powerState(new PowerState(this)),
+      m_shutdownWidget(new PluginWidget(m_powerState)),
+      m_powerStatusWidget(new PowerStatusWidget(m_powerState)),
+      m_tipsLabel(new QLabel)
 {
     m_tipsLabel->setVisible(false);
     m_tipsLabel->setObjectName("power");
@@ -43,7 +41,8 @@ ShutdownPlugin::ShutdownPlugin(QObject *parent)
     m_tipsLabel->setStyleSheet("color:white;"
                                "padding: 0px 3px;");
 
-    connect(m_powerInter, &DBusPower::BatteryPercentageChanged, this, &ShutdownPlugin::updateBatteryVisible);
+    connect(m_powerState, &PowerState::batteryChanged, this, &ShutdownPlugin::updateBatteryVisible);
+    connect(m_powerState, &PowerState::userCountChanged, this, [=] { m_contextMenus.clear(); });
     connect(m_shutdownWidget, &PluginWidget::requestContextMenu, this, &ShutdownPlugin::requestContextMenu);
     connect(m_powerStatusWidget, &PowerStatusWidget::requestContextMenu, this, &ShutdownPlugin::requestContextMenu);
 }
@@ -68,25 +67,31 @@ QWidget *ShutdownPlugin::itemWidget(const QString &itemKey)
     return nullptr;
 }
 
+bool ShutdownPlugin::itemHoverEffect(const QString &itemKey)
+{
+    Q_UNUSED(itemKey);
+
+    return true;
+}
+
 QWidget *ShutdownPlugin::itemTipsWidget(const QString &itemKey)
 {
-    const BatteryPercentageMap data = m_powerInter->batteryPercentage();
     m_tipsLabel->setObjectName(itemKey);
 
-    if (data.isEmpty() || (itemKey == SHUTDOWN_KEY && displayMode() == Dock::Efficient))
+    if (!m_powerState->hasBattery() || (itemKey == SHUTDOWN_KEY && displayMode() == Dock::Efficient))
     {
         m_tipsLabel->setText(tr("Shut down"));
         return m_tipsLabel;
     }
 
-    const uint percentage = qMin(100.0, qMax(0.0, data.value("Display")));
+    const uint percentage = m_powerState->percentage();
     const QString value = QString("%1%").arg(std::round(percentage));
-    const bool charging = !m_powerInter->onBattery();
+    const bool charging = !m_powerState->onBattery();
     if (!charging)
         m_tipsLabel->setText(tr("Remaining Capacity %1").arg(value));
     else
     {
-        const int batteryState = m_powerInter->batteryState()["Display"];
+        const int batteryState = m_powerState->batteryState();
 
         if (batteryState == BATTERY_FULL || percentage == 100.)
             m_tipsLabel->setText(tr("Charged %1").arg(value));
@@ -134,8 +139,33 @@ const QString ShutdownPlugin::itemCommand(const QString &itemKey)
     return QString();
 }
 
+QVariantMap ShutdownPlugin::itemCommandDescriptor(const QString &itemKey)
+{
+    QVariantMap descriptor;
+
+    if (itemKey == SHUTDOWN_KEY)
+    {
+        descriptor["service"] = "com.deepin.dde.shutdownFront";
+        descriptor["path"] = "/com/deepin/dde/shutdownFront";
+        descriptor["interface"] = "com.deepin.dde.shutdownFront";
+        descriptor["method"] = "Show";
+    } else if (itemKey == POWER_KEY) {
+        descriptor["service"] = "com.deepin.dde.ControlCenter";
+        descriptor["path"] = "/com/deepin/dde/ControlCenter";
+        descriptor["interface"] = "com.deepin.dde.ControlCenter";
+        descriptor["method"] = "ShowModule";
+        descriptor["arguments"] = QVariantList() << "power";
+    }
+
+    return descriptor;
+}
+
 const QString ShutdownPlugin::itemContextMenu(const QString &itemKey)
 {
+    const auto cached = m_contextMenus.constFind(itemKey);
+    if (cached != m_contextMenus.constEnd())
+        return cached.value();
+
     QList<QVariant> items;
     items.reserve(6);
 
@@ -173,7 +203,7 @@ const QString ShutdownPlugin::itemContextMenu(const QString &itemKey)
         logout["isActive"] = true;
         items.push_back(logout);
 
-        if (DBusAccount().userList().count() > 1)
+        if (m_powerState->userCount() > 1)
         {
             QMap<QString, QVariant> switchUser;
             switchUser["itemId"] = "SwitchUser";
@@ -197,7 +227,10 @@ const QString ShutdownPlugin::itemContextMenu(const QString &itemKey)
     menu["checkableMenu"] = false;
     menu["singleCheck"] = false;
 
-    return QJsonDocument::fromVariant(menu).toJson();
+    const QString menuJson = QJsonDocument::fromVariant(menu).toJson();
+    m_contextMenus.insert(itemKey, menuJson);
+
+    return menuJson;
 }
 
 void ShutdownPlugin::invokedMenuItem(const QString &itemKey, const QString &menuId, const bool checked)
@@ -223,6 +256,7 @@ void ShutdownPlugin::displayModeChanged(const Dock::DisplayMode displayMode)
 {
     Q_UNUSED(displayMode);
 
+    m_contextMenus.clear();
     m_shutdownWidget->update();
 
     updateBatteryVisible();
@@ -242,7 +276,7 @@ void ShutdownPlugin::setSortKey(const QString &itemKey, const int order)
 
 void ShutdownPlugin::updateBatteryVisible()
 {
-    const bool exist = !m_powerInter->batteryPercentage().isEmpty();
+    const bool exist = m_powerState->hasBattery();
 
     if (!exist || displayMode() == Dock::Fashion)
         m_proxyInter->itemRemoved(this, POWER_KEY);
@@ -261,9 +295,11 @@ void ShutdownPlugin::delayLoader()
 
     ++retryTimes;
 
-    if (m_powerInter->isValid() || retryTimes > 10)
+    if (m_powerState->isValid() || retryTimes > 10)
     {
-        qDebug() << "load power item, dbus valid:" << m_powerInter->isValid();
+        qDebug() << "load power item, dbus valid:" << m_powerState->isValid();
+
+        m_powerState->refreshAll();
 
         m_proxyInter->itemAdded(this, SHUTDOWN_KEY);
         displayModeChanged(displayMode());
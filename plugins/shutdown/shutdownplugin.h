@@ -25,7 +25,7 @@
 #include "pluginsiteminterface.h"
 #include "pluginwidget.h"
 #include "powerstatuswidget.h"
-#include "dbus/dbuspower.h"
+#include "powerstate.h"
 
 #include <QLabel>
 
@@ -50,8 +50,10 @@ public:
     bool pluginIsDisable() override;
 
     QWidget *itemWidget(const QString &itemKey) override;
+    Q_INVOKABLE bool itemHoverEffect(const QString &itemKey);
     QWidget *itemTipsWidget(const QString &itemKey) override;
     const QString itemCommand(const QString &itemKey) override;
+    Q_INVOKABLE QVariantMap itemCommandDescriptor(const QString &itemKey);
     const QString itemContextMenu(const QString &itemKey) override;
     void invokedMenuItem(const QString &itemKey, const QString &menuId, const bool checked) override;
     void displayModeChanged(const Dock::DisplayMode displayMode) override;
@@ -66,11 +68,13 @@ private:
 
 private:
     QSettings m_settings;
+    PowerState *m_powerState;
     PluginWidget *m_shutdownWidget;
     PowerStatusWidget *m_powerStatusWidget;
     QLabel *m_tipsLabel;
 
-    DBusPower *m_powerInter;
+    // menu json of each item, cleared when display mode or user count changed
+    QMap<QString, QString> m_contextMenus;
 };
 
 #endif // SHUTDOWNPLUGIN_H
@@ -86,9 +86,8 @@ void VolumeSlider::mouseMoveEvent(QMouseEvent *e)
     const int value = minimum() + (double((maximum()) - minimum()) * e->x() / rect().width());
     const int normalized = std::max(std::min(maximum(), value), 0);
 
+    // QSlider emits valueChanged only when the value really changed
     QSlider::setValue(normalized);
-
-    emit valueChanged(normalized);
 }
 
 void VolumeSlider::mouseReleaseEvent(QMouseEvent *e)
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dbuscallqueue.h"
+
+DBusCallQueue::DBusCallQueue(QDBusAbstractInterface *inter)
+    : QObject(inter),
+
+      m_inter(inter)
+{
+}
+
+void DBusCallQueue::call(const QString &callName, const QList<QVariant> &args)
+{
+    if (!m_processingCalls.contains(callName))
+        return send(callName, args);
+
+    // replace the waitting arguments, only the latest value is sent
+    m_waittingCalls.insert(callName, args);
+}
+
+void DBusCallQueue::onPendingCallFinished(QDBusPendingCallWatcher *w)
+{
+    w->deleteLater();
+
+    const auto callName = m_processingCalls.key(w);
+    Q_ASSERT(!callName.isEmpty());
+    if (callName.isEmpty())
+        return;
+
+    m_processingCalls.remove(callName);
+
+    if (m_waittingCalls.contains(callName))
+        send(callName, m_waittingCalls.take(callName));
+}
+
+void DBusCallQueue::send(const QString &callName, const QList<QVariant> &args)
+{
+    QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(m_inter->asyncCallWithArgumentList(callName, args), this);
+    connect(watcher, &QDBusPendingCallWatcher::finished, this, &DBusCallQueue::onPendingCallFinished);
+
+    m_processingCalls.insert(callName, watcher);
+}
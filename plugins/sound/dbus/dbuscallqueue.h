@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DBUSCALLQUEUE_H
+#define DBUSCALLQUEUE_H
+
+#include <QObject>
+#include <QMap>
+#include <QDBusAbstractInterface>
+#include <QDBusPendingCallWatcher>
+
+///
+/// \brief The DBusCallQueue class keeps at most one call in flight for each method,
+/// new arguments replace the waiting ones so only the latest value is sent.
+///
+class DBusCallQueue : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit DBusCallQueue(QDBusAbstractInterface *inter);
+
+    void call(const QString &callName, const QList<QVariant> &args);
+
+private slots:
+    void onPendingCallFinished(QDBusPendingCallWatcher *w);
+
+private:
+    void send(const QString &callName, const QList<QVariant> &args);
+
+private:
+    QDBusAbstractInterface *m_inter;
+
+    QMap<QString, QDBusPendingCallWatcher *> m_processingCalls;
+    QMap<QString, QList<QVariant>> m_waittingCalls;
+};
+
+#endif // DBUSCALLQUEUE_H
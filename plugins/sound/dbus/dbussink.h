@@ -20,6 +20,8 @@
 #include <QtCore/QVariant>
 #include <QtDBus/QtDBus>
 
+#include "dbuscallqueue.h"
+
 /*
  * Proxy class for interface com.deepin.daemon.Audio.Sink
  */
@@ -152,40 +154,7 @@ public Q_SLOTS: // METHODS
 private:
     inline void CallQueued(const QString &callName, const QList<QVariant> &args)
     {
-        if (m_waittingCalls.contains(callName))
-        {
-            m_waittingCalls[callName] = args;
-            return;
-        }
-
-        if (m_processingCalls.contains(callName))
-        {
-            m_waittingCalls.insert(callName, args);
-        } else {
-            QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(asyncCallWithArgumentList(callName, args));
-            connect(watcher, &QDBusPendingCallWatcher::finished, this, &DBusSink::onPendingCallFinished);
-
-            m_processingCalls.insert(callName, watcher);
-        }
-    }
-
-private slots:
-    void onPendingCallFinished(QDBusPendingCallWatcher *w)
-    {
-        w->deleteLater();
-
-        const auto callName = m_processingCalls.key(w);
-        Q_ASSERT(!callName.isEmpty());
-        if (callName.isEmpty())
-            return;
-
-        m_processingCalls.remove(callName);
-
-        if (!m_waittingCalls.contains(callName))
-            return;
-
-        const auto args = m_waittingCalls.take(callName);
-        CallQueued(callName, args);
+        m_callQueue->call(callName, args);
     }
 
 Q_SIGNALS: // SIGNALS
@@ -201,8 +170,7 @@ void SupportFadeChanged();
 void VolumeChanged();
 
 private:
-    QMap<QString, QDBusPendingCallWatcher *> m_processingCalls;
-    QMap<QString, QList<QVariant>> m_waittingCalls;
+    DBusCallQueue *m_callQueue;
 };
 
 namespace com {
@@ -24,6 +24,7 @@
 #include <QHBoxLayout>
 #include <QIcon>
 #include <QApplication>
+#include <QDebug>
 #include <DHiDPIHelper>
 
 DWIDGET_USE_NAMESPACE
@@ -42,13 +43,11 @@ SinkInputWidget::SinkInputWidget(const QString &inputPath, QWidget *parent)
 
       m_inputInter(new DBusSinkInput(inputPath, this)),
 
+      m_mute(false),
+
       m_volumeIcon(new DImageButton),
       m_volumeSlider(new VolumeSlider)
 {
-    const QString iconName = m_inputInter->icon();
-    m_volumeIcon->setAccessibleName("app-" + iconName + "-icon");
-    m_volumeIcon->setPixmap(getIconFromTheme(iconName, QSize(24, 24)));
-    m_volumeSlider->setAccessibleName("app-" + iconName + "-slider");
     m_volumeSlider->setMinimum(0);
     m_volumeSlider->setMaximum(1000);
 
@@ -62,16 +61,23 @@ SinkInputWidget::SinkInputWidget(const QString &inputPath, QWidget *parent)
     connect(m_volumeSlider, &VolumeSlider::valueChanged, this, &SinkInputWidget::setVolume);
     connect(m_volumeSlider, &VolumeSlider::requestPlaySoundEffect, this, &SinkInputWidget::onPlaySoundEffect);
     connect(m_volumeIcon, &DImageButton::clicked, this, &SinkInputWidget::setMute);
-    connect(m_inputInter, &DBusSinkInput::MuteChanged, this, &SinkInputWidget::setMuteIcon);
+    connect(m_inputInter, &DBusSinkInput::MuteChanged, this, &SinkInputWidget::onMuteChanged);
+    connect(m_inputInter, &DBusSinkInput::IconChanged, this, &SinkInputWidget::onIconChanged);
     connect(m_inputInter, &DBusSinkInput::VolumeChanged, this, [=] { m_volumeSlider->setValue(m_inputInter->volume() * 1000); });
 
     setLayout(centralLayout);
     setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Fixed);
     setFixedHeight(30);
 
-    setMuteIcon();
+    setIconName(QString());
 
-    emit m_inputInter->VolumeChanged();
+    // fetch all properties in one async call instead of blocking on each of them
+    QDBusMessage msg = QDBusMessage::createMethodCall(m_inputInter->service(), m_inputInter->path(),
+                                                      "org.freedesktop.DBus.Properties", "GetAll");
+    msg << QString(DBusSinkInput::staticInterfaceName());
+
+    QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(m_inputInter->connection().asyncCall(msg), this);
+    connect(watcher, &QDBusPendingCallWatcher::finished, this, &SinkInputWidget::onPropertiesFetched);
 }
 
 void SinkInputWidget::setVolume(const int value)
@@ -81,15 +87,15 @@ void SinkInputWidget::setVolume(const int value)
 
 void SinkInputWidget::setMute()
 {
-    m_inputInter->SetMuteQueued(!m_inputInter->mute());
+    m_inputInter->SetMuteQueued(!m_mute);
 }
 
 void SinkInputWidget::setMuteIcon()
 {
-    if (m_inputInter->mute()) {
+    if (m_mute) {
         const auto ratio = devicePixelRatioF();
         QPixmap muteIcon = DHiDPIHelper::loadNxPixmap(":/icons/image/audio-volume-muted-symbolic.svg");
-        QPixmap appIconSource(getIconFromTheme(m_inputInter->icon(), QSize(24, 24)));
+        QPixmap appIconSource(m_appIcon);
 
         QPixmap temp(appIconSource.size());
         temp.fill(Qt::transparent);
@@ -107,7 +113,7 @@ void SinkInputWidget::setMuteIcon()
         appIconSource.setDevicePixelRatio(ratio);
         m_volumeIcon->setPixmap(appIconSource);
     } else {
-        m_volumeIcon->setPixmap(getIconFromTheme(m_inputInter->icon(), QSize(24, 24)));
+        m_volumeIcon->setPixmap(m_appIcon);
     }
 }
 
@@ -116,3 +122,43 @@ void SinkInputWidget::onPlaySoundEffect()
     // set the mute property to false to play sound effects.
     m_inputInter->SetMuteQueued(false);
 }
+
+void SinkInputWidget::onPropertiesFetched(QDBusPendingCallWatcher *w)
+{
+    w->deleteLater();
+
+    QDBusPendingReply<QVariantMap> reply = *w;
+    if (reply.isError())
+    {
+        qWarning() << "fetch sink input properties failed:" << m_inputInter->path() << reply.error().message();
+        return;
+    }
+
+    const QVariantMap &props = reply.value();
+
+    m_mute = props.value("Mute").toBool();
+    m_volumeSlider->setValue(props.value("Volume").toDouble() * 1000);
+    setIconName(props.value("Icon").toString());
+}
+
+void SinkInputWidget::onMuteChanged()
+{
+    m_mute = m_inputInter->mute();
+
+    setMuteIcon();
+}
+
+void SinkInputWidget::onIconChanged()
+{
+    setIconName(m_inputInter->icon());
+}
+
+void SinkInputWidget::setIconName(const QString &iconName)
+{
+    m_appIcon = getIconFromTheme(iconName, QSize(24, 24));
+
+    m_volumeIcon->setAccessibleName("app-" + iconName + "-icon");
+    m_volumeSlider->setAccessibleName("app-" + iconName + "-slider");
+
+    setMuteIcon();
+}
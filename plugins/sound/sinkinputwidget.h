@@ -42,10 +42,19 @@ private slots:
     void setMute();
     void setMuteIcon();
     void onPlaySoundEffect();
+    void onPropertiesFetched(QDBusPendingCallWatcher *w);
+    void onMuteChanged();
+    void onIconChanged();
+
+private:
+    void setIconName(const QString &iconName);
 
 private:
     DBusSinkInput *m_inputInter;
 
+    bool m_mute;
+    QPixmap m_appIcon;
+
     Dtk::Widget::DImageButton *m_volumeIcon;
     VolumeSlider *m_volumeSlider;
 };
@@ -41,6 +41,7 @@ SoundApplet::SoundApplet(QWidget *parent)
       m_applicationTitle(new QWidget),
       m_volumeBtn(new DImageButton),
       m_volumeSlider(new VolumeSlider),
+      m_updateInputsTimer(new QTimer(this)),
 
       m_audioInter(new DBusAudio(this)),
       m_defSinkInter(nullptr)
@@ -109,10 +110,15 @@ SoundApplet::SoundApplet(QWidget *parent)
     setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
     setStyleSheet("background-color:transparent;");
 
+    // sink inputs may change many times in a short time, e.g. browser tabs playing short sounds
+    m_updateInputsTimer->setSingleShot(true);
+    m_updateInputsTimer->setInterval(100);
+
     connect(m_volumeBtn, &DImageButton::clicked, this, &SoundApplet::toggleMute);
     connect(m_volumeSlider, &VolumeSlider::valueChanged, this, &SoundApplet::volumeSliderValueChanged);
     connect(m_volumeSlider, &VolumeSlider::requestPlaySoundEffect, this, &SoundApplet::onPlaySoundEffect);
     connect(m_audioInter, &DBusAudio::SinkInputsChanged, this, &SoundApplet::sinkInputsChanged);
+    connect(m_updateInputsTimer, &QTimer::timeout, this, &SoundApplet::refreshSinkInputs);
     connect(m_audioInter, &DBusAudio::DefaultSinkChanged, this, static_cast<void (SoundApplet::*)()>(&SoundApplet::defaultSinkChanged));
     connect(this, static_cast<void (SoundApplet::*)(DBusSink*) const>(&SoundApplet::defaultSinkChanged), this, &SoundApplet::onVolumeChanged);
 
@@ -176,25 +182,42 @@ void SoundApplet::volumeSliderValueChanged()
 
 void SoundApplet::sinkInputsChanged()
 {
-    m_centralWidget->setVisible(false);
-    QVBoxLayout *appLayout = m_centralLayout;
-    while (QLayoutItem *item = appLayout->takeAt(4))
+    m_updateInputsTimer->start();
+}
+
+void SoundApplet::refreshSinkInputs()
+{
+    QStringList inputPaths;
+    for (const auto &input : m_audioInter->sinkInputs())
+        inputPaths << input.path();
+
+    // remove widgets of finished inputs, keep the others untouched
+    for (auto it(m_sinkInputWidgets.begin()); it != m_sinkInputWidgets.end();)
     {
-        delete item->widget();
-        delete item;
+        if (inputPaths.contains(it.key()))
+        {
+            ++it;
+            continue;
+        }
+
+        delete it.value();
+        it = m_sinkInputWidgets.erase(it);
     }
 
-    m_applicationTitle->setVisible(false);
-    for (auto input : m_audioInter->sinkInputs())
+    for (const auto &path : inputPaths)
     {
-        m_applicationTitle->setVisible(true);
-        SinkInputWidget *si = new SinkInputWidget(input.path());
-        appLayout->addWidget(si);
+        if (m_sinkInputWidgets.contains(path))
+            continue;
+
+        SinkInputWidget *si = new SinkInputWidget(path);
+        m_centralLayout->addWidget(si);
+        m_sinkInputWidgets.insert(path, si);
     }
 
+    m_applicationTitle->setVisible(!m_sinkInputWidgets.isEmpty());
+
     const int contentHeight = m_centralWidget->sizeHint().height();
     m_centralWidget->setFixedHeight(contentHeight);
-    m_centralWidget->setVisible(true);
     setFixedHeight(std::min(contentHeight, MAX_HEIGHT));
 }
 
@@ -214,7 +237,7 @@ void SoundApplet::delayLoad()
     if (valid || retry_times > 10)
     {
         QMetaObject::invokeMethod(this, "defaultSinkChanged", Qt::QueuedConnection);
-        QMetaObject::invokeMethod(this, "sinkInputsChanged", Qt::QueuedConnection);
+        QMetaObject::invokeMethod(this, "refreshSinkInputs", Qt::QueuedConnection);
     } else {
         QTimer::singleShot(1000, this, &SoundApplet::delayLoad);
     }
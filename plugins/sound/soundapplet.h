@@ -30,8 +30,11 @@
 #include <QVBoxLayout>
 #include <QLabel>
 #include <QSlider>
+#include <QTimer>
 #include <dimagebutton.h>
 
+class SinkInputWidget;
+
 class SoundApplet : public QScrollArea
 {
     Q_OBJECT
@@ -51,6 +54,7 @@ private slots:
     void onVolumeChanged();
     void volumeSliderValueChanged();
     void sinkInputsChanged();
+    void refreshSinkInputs();
     void toggleMute();
     void delayLoad();
     void onPlaySoundEffect();
@@ -61,9 +65,12 @@ private:
     Dtk::Widget::DImageButton *m_volumeBtn;
     VolumeSlider *m_volumeSlider;
     QVBoxLayout *m_centralLayout;
+    QTimer *m_updateInputsTimer;
 
     DBusAudio *m_audioInter;
     DBusSink *m_defSinkInter;
+
+    QMap<QString, SinkInputWidget *> m_sinkInputWidgets;
 };
 
 #endif // SOUNDAPPLET_H
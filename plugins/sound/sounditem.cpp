@@ -72,6 +72,10 @@ QWidget *SoundItem::popupApplet()
 
 const QString SoundItem::contextMenu() const
 {
+    // cached until mute state changed
+    if (!m_contextMenu.isNull())
+        return m_contextMenu;
+
     QList<QVariant> items;
     items.reserve(2);
 
@@ -95,7 +99,9 @@ const QString SoundItem::contextMenu() const
     menu["checkableMenu"] = false;
     menu["singleCheck"] = false;
 
-    return QJsonDocument::fromVariant(menu).toJson();
+    m_contextMenu = QJsonDocument::fromVariant(menu).toJson();
+
+    return m_contextMenu;
 }
 
 void SoundItem::invokeMenuItem(const QString menuId, const bool checked)
@@ -144,8 +150,8 @@ void SoundItem::mousePressEvent(QMouseEvent *e)
 
 void SoundItem::wheelEvent(QWheelEvent *e)
 {
-    QWheelEvent *event = new QWheelEvent(e->pos(), e->delta(), e->buttons(), e->modifiers());
-    qApp->postEvent(m_applet->mainSlider(), event);
+    // slider only cares about the delta, deliver it directly instead of posting a copy
+    qApp->sendEvent(m_applet->mainSlider(), e);
 
     e->accept();
 }
@@ -226,7 +232,9 @@ void SoundItem::refershTips(const bool force)
 void SoundItem::sinkChanged(DBusSink *sink)
 {
     m_sinkInter = sink;
+    m_contextMenu.clear();
 
+    connect(m_sinkInter, &DBusSink::MuteChanged, this, [=] { m_contextMenu.clear(); });
     connect(m_sinkInter, &DBusSink::MuteChanged, this, &SoundItem::refershIcon);
     connect(m_sinkInter, &DBusSink::VolumeChanged, this, &SoundItem::refershIcon);
     refershIcon();
@@ -60,6 +60,7 @@ private:
     SoundApplet *m_applet;
     DBusSink *m_sinkInter;
     QPixmap m_iconPixmap;
+    mutable QString m_contextMenu;
 };
 
 #endif // SOUNDITEM_H
@@ -74,6 +74,13 @@ QWidget *SoundPlugin::itemWidget(const QString &itemKey)
     return m_soundItem;
 }
 
+bool SoundPlugin::itemHoverEffect(const QString &itemKey)
+{
+    Q_UNUSED(itemKey);
+
+    return true;
+}
+
 QWidget *SoundPlugin::itemTipsWidget(const QString &itemKey)
 {
     Q_UNUSED(itemKey);
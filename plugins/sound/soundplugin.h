@@ -44,6 +44,7 @@ public:
     bool pluginIsDisable();
 
     QWidget *itemWidget(const QString &itemKey);
+    Q_INVOKABLE bool itemHoverEffect(const QString &itemKey);
     QWidget *itemTipsWidget(const QString &itemKey);
     QWidget *itemPopupApplet(const QString &itemKey);
 
@@ -88,6 +88,13 @@ QWidget *SystemTrayPlugin::itemWidget(const QString &itemKey)
     return m_trayList.value(itemKey);
 }
 
+bool SystemTrayPlugin::itemHoverEffect(const QString &itemKey)
+{
+    Q_UNUSED(itemKey);
+
+    return true;
+}
+
 QWidget *SystemTrayPlugin::itemTipsWidget(const QString &itemKey)
 {
     Q_UNUSED(itemKey);
@@ -230,7 +237,7 @@ void SystemTrayPlugin::trayAdded(const QString itemKey)
     if (XWindowTrayWidget::isWinIdKey(itemKey)) {
         auto winId = XWindowTrayWidget::toWinId(itemKey);
         getWindowClass(winId);
-        AbstractTrayWidget *trayWidget = new XWindowTrayWidget(winId);
+        AbstractTrayWidget *trayWidget = new XWindowTrayWidget(m_proxyInter, winId);
         addTrayWidget(trayWidget);
     }
 
@@ -47,6 +47,7 @@ public:
     void displayModeChanged(const Dock::DisplayMode mode) Q_DECL_OVERRIDE;
 
     QWidget *itemWidget(const QString &itemKey) Q_DECL_OVERRIDE;
+    Q_INVOKABLE bool itemHoverEffect(const QString &itemKey);
     QWidget *itemTipsWidget(const QString &itemKey) Q_DECL_OVERRIDE;
     QWidget *itemPopupApplet(const QString &itemKey) Q_DECL_OVERRIDE;
 
@@ -29,7 +29,6 @@
 #include <QProcess>
 #include <QThread>
 #include <QApplication>
-#include <QScreen>
 
 #include <X11/extensions/shape.h>
 #include <X11/extensions/XTest.h>
@@ -42,29 +41,14 @@ static const qreal iconSize = 16;
 
 #define DRAG_THRESHOLD  20
 
-const QPoint rawXPosition(const QPoint &scaledPos)
-{
-    QRect g = qApp->primaryScreen()->geometry();
-    for (auto *screen : qApp->screens())
-    {
-        const QRect &sg = screen->geometry();
-        if (sg.contains(scaledPos))
-        {
-            g = sg;
-            break;
-        }
-    }
-
-    return g.topLeft() + (scaledPos - g.topLeft()) * qApp->devicePixelRatio();
-}
-
 void sni_cleanup_xcb_image(void *data)
 {
     xcb_image_destroy(static_cast<xcb_image_t*>(data));
 }
 
-XWindowTrayWidget::XWindowTrayWidget(quint32 winId, QWidget *parent)
+XWindowTrayWidget::XWindowTrayWidget(PluginProxyInterface *proxyInter, quint32 winId, QWidget *parent)
     : AbstractTrayWidget(parent),
+      m_proxyInter(proxyInter),
       m_windowId(winId)
 {
     wrapWindow();
@@ -148,7 +132,7 @@ void XWindowTrayWidget::configContainerPosition()
 {
     auto c = QX11Info::connection();
 
-    const QPoint p(rawXPosition(QCursor::pos()));
+    const QPoint p(m_proxyInter->rawXPosition(QCursor::pos()));
 
     const uint32_t containerVals[4] = {uint32_t(p.x()), uint32_t(p.y()), 1, 1};
     xcb_configure_window(c, m_containerWid,
@@ -259,7 +243,7 @@ void XWindowTrayWidget::wrapWindow()
 void XWindowTrayWidget::sendHoverEvent()
 {
     // fake enter event
-    const QPoint p(rawXPosition(QCursor::pos()));
+    const QPoint p(m_proxyInter->rawXPosition(QCursor::pos()));
     configContainerPosition();
     setX11PassMouseEvent(false);
     setWindowOnTop(true);
@@ -298,7 +282,7 @@ void XWindowTrayWidget::sendClick(uint8_t mouseButton, int x, int y)
 
     m_sendHoverEvent->stop();
 
-    const QPoint p(rawXPosition(QPoint(x, y)));
+    const QPoint p(m_proxyInter->rawXPosition(QPoint(x, y)));
     configContainerPosition();
     setX11PassMouseEvent(false);
     setWindowOnTop(true);
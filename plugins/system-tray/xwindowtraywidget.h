@@ -25,6 +25,8 @@
 #include <QWidget>
 #include <QTimer>
 
+#include "pluginproxyinterface.h"
+
 #include <abstracttraywidget.h>
 
 class XWindowTrayWidget : public AbstractTrayWidget
@@ -32,7 +34,7 @@ class XWindowTrayWidget : public AbstractTrayWidget
     Q_OBJECT
 
 public:
-    explicit XWindowTrayWidget(quint32 winId, QWidget *parent = 0);
+    explicit XWindowTrayWidget(PluginProxyInterface *proxyInter, quint32 winId, QWidget *parent = 0);
     ~XWindowTrayWidget();
 
     void updateIcon() Q_DECL_OVERRIDE;
@@ -64,6 +66,7 @@ private slots:
 
 private:
     bool m_active = false;
+    PluginProxyInterface *m_proxyInter;
     WId m_windowId;
     WId m_containerWid;
     QImage m_image;
@@ -32,18 +32,16 @@
 
 DWIDGET_USE_NAMESPACE
 
-const QString TrashDir = QDir::homePath() + "/.local/share/Trash";
-
 using SoundEffectInter = com::deepin::daemon::SoundEffect;
 
-PopupControlWidget::PopupControlWidget(QWidget *parent)
+PopupControlWidget::PopupControlWidget(TrashService *trashService, QWidget *parent)
     : QWidget(parent),
 
       m_empty(false),
 
-      m_fsWatcher(new QFileSystemWatcher(this))
+      m_trashService(trashService)
 {
-    connect(m_fsWatcher, &QFileSystemWatcher::directoryChanged, this, &PopupControlWidget::trashStatusChanged, Qt::QueuedConnection);
+    connect(m_trashService, &TrashService::itemCountChanged, this, &PopupControlWidget::trashStatusChanged, Qt::QueuedConnection);
 
     setObjectName("trash");
     setFixedWidth(80);
@@ -58,7 +56,7 @@ bool PopupControlWidget::empty() const
 
 int PopupControlWidget::trashItems() const
 {
-    return m_trashItemsCount;
+    return m_trashService->itemCount();
 }
 
 QSize PopupControlWidget::sizeHint() const
@@ -68,7 +66,7 @@ QSize PopupControlWidget::sizeHint() const
 
 const QString PopupControlWidget::trashDir()
 {
-    return TrashDir;
+    return TrashService::trashDir();
 }
 
 void PopupControlWidget::openTrashFloder()
@@ -84,7 +82,7 @@ void PopupControlWidget::clearTrashFloder()
 {
     // show confrim dialog
     bool accept = false;
-    const int itemCount = trashItemCount();
+    const int itemCount = m_trashService->itemCount();
     const QStringList btns = {tr("Cancel"), tr("Empty")};
 
     DDialog *dialog = new DDialog(nullptr);
@@ -123,30 +121,10 @@ void PopupControlWidget::clearTrashFloder()
 //    }
 }
 
-int PopupControlWidget::trashItemCount() const
-{
-    return QDir(TrashDir + "/info").entryInfoList().count() - 2;
-}
-
 void PopupControlWidget::trashStatusChanged()
 {
-    const bool files = QDir(TrashDir + "/files").exists();
-//    const bool info = QDir(TrashDir + "/info").exists();
-
-    // add monitor paths
-    m_fsWatcher->addPath(TrashDir);
-    if (files)
-        m_fsWatcher->addPath(TrashDir + "/files");
-//    if (info)
-//        m_fsWatcher->addPath(TrashDir + "/info");
-
     // check empty
-    if (!files)
-        m_trashItemsCount = 0;
-    else
-        m_trashItemsCount = QDir(TrashDir + "/files").entryList().count() - 2;
-
-    const bool empty = m_trashItemsCount == 0;
+    const bool empty = m_trashService->itemCount() == 0;
     if (m_empty == empty)
         return;
 
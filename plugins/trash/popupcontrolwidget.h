@@ -22,8 +22,9 @@
 #ifndef POPUPCONTROLWIDGET_H
 #define POPUPCONTROLWIDGET_H
 
+#include "trashservice.h"
+
 #include <QWidget>
-#include <QFileSystemWatcher>
 
 #include <dlinkbutton.h>
 
@@ -32,7 +33,7 @@ class PopupControlWidget : public QWidget
     Q_OBJECT
 
 public:
-    explicit PopupControlWidget(QWidget *parent = 0);
+    explicit PopupControlWidget(TrashService *trashService, QWidget *parent = 0);
 
     bool empty() const;
     int trashItems() const;
@@ -46,20 +47,16 @@ public slots:
 signals:
     void emptyChanged(const bool empty) const;
 
-private:
-    int trashItemCount() const;
-
 private slots:
     void trashStatusChanged();
 
 private:
     bool m_empty;
-    int m_trashItemsCount;
 
 //    Dtk::Widget::DLinkButton *m_openBtn;
 //    Dtk::Widget::DLinkButton *m_clearBtn;
 
-    QFileSystemWatcher *m_fsWatcher;
+    TrashService *m_trashService;
 };
 
 #endif // POPUPCONTROLWIDGET_H
@@ -52,6 +52,13 @@ QWidget *TrashPlugin::itemWidget(const QString &itemKey)
     return m_trashWidget;
 }
 
+bool TrashPlugin::itemHoverEffect(const QString &itemKey)
+{
+    Q_UNUSED(itemKey);
+
+    return true;
+}
+
 QWidget *TrashPlugin::itemTipsWidget(const QString &itemKey)
 {
     Q_UNUSED(itemKey);
@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "trashservice.h"
+
+#include <QDir>
+#include <QFileInfo>
+#include <QProcess>
+#include <QDebug>
+#include <QDBusConnection>
+#include <QDBusMessage>
+
+#include <sys/inotify.h>
+#include <unistd.h>
+
+const QString TrashDir = QDir::homePath() + "/.local/share/Trash";
+const QString TrashInfoDir = TrashDir + "/info";
+
+// gvfs-trash is deprecated and missing on newer systems, gio does the same job
+const QList<QStringList> TrashCommands = { { "gvfs-trash" }, { "gio", "trash" } };
+
+TrashService::TrashService(QObject *parent)
+    : QObject(parent),
+
+      m_inotifyFd(inotify_init1(IN_NONBLOCK | IN_CLOEXEC)),
+      m_trashWatch(-1),
+      m_infoWatch(-1),
+      m_itemCount(0),
+      m_notifier(nullptr)
+{
+    if (m_inotifyFd < 0)
+        qWarning() << "inotify init failed, trash item count will not be updated";
+    else
+    {
+        m_notifier = new QSocketNotifier(m_inotifyFd, QSocketNotifier::Read, this);
+        connect(m_notifier, &QSocketNotifier::activated, this, &TrashService::onInotifyEvent);
+    }
+
+    // make sure there is something to watch before anything is trashed
+    QDir().mkpath(TrashInfoDir);
+
+    watchTrash();
+    rescan();
+}
+
+TrashService::~TrashService()
+{
+    if (m_inotifyFd >= 0)
+        close(m_inotifyFd);
+}
+
+const QString TrashService::trashDir()
+{
+    return TrashDir;
+}
+
+void TrashService::moveToTrash(const QList<QUrl> &urls)
+{
+    QStringList files;
+    files.reserve(urls.size());
+    for (const auto &url : urls)
+        if (url.isLocalFile())
+            files << QFileInfo(url.toLocalFile()).absoluteFilePath();
+
+    if (files.isEmpty())
+        return;
+
+    // trash all dropped files in one async process
+    startTrash(files);
+}
+
+void TrashService::startTrash(const QStringList &files, const int command)
+{
+    QStringList args = TrashCommands[command];
+    const QString program = args.takeFirst();
+    args << "-f" << files;
+
+    QProcess *proc = new QProcess(this);
+    connect(proc, static_cast<void (QProcess::*)(int)>(&QProcess::finished), proc, &QProcess::deleteLater);
+    // finished never comes if the program could not be started
+    connect(proc, &QProcess::errorOccurred, this, [=](const QProcess::ProcessError error) {
+        proc->deleteLater();
+
+        if (error == QProcess::FailedToStart && command + 1 != TrashCommands.size())
+            startTrash(files, command + 1);
+    });
+
+    proc->start(program, args);
+}
+
+void TrashService::uninstallApp(const QString &appKey)
+{
+    QDBusMessage msg = QDBusMessage::createMethodCall("com.deepin.dde.Launcher", "/com/deepin/dde/Launcher",
+                                                      "com.deepin.dde.Launcher", "UninstallApp");
+    msg << appKey;
+
+    QDBusConnection::sessionBus().asyncCall(msg);
+}
+
+void TrashService::onInotifyEvent()
+{
+    alignas(struct inotify_event) char buf[4096];
+
+    int count = m_itemCount;
+    bool needRescan = false;
+    bool needRewatch = false;
+
+    forever
+    {
+        const ssize_t len = read(m_inotifyFd, buf, sizeof(buf));
+        if (len <= 0)
+            break;
+
+        for (char *ptr = buf; ptr < buf + len;)
+        {
+            const struct inotify_event *event = reinterpret_cast<const struct inotify_event *>(ptr);
+            ptr += sizeof(struct inotify_event) + event->len;
+
+            if (event->mask & IN_Q_OVERFLOW)
+            {
+                needRescan = true;
+                continue;
+            }
+
+            if (event->wd == m_trashWatch)
+            {
+                // info folder created or removed
+                if (event->mask & IN_IGNORED)
+                    m_trashWatch = -1;
+                needRewatch = true;
+                continue;
+            }
+
+            if (event->wd != m_infoWatch)
+                continue;
+
+            if (event->mask & IN_IGNORED)
+            {
+                m_infoWatch = -1;
+                needRewatch = true;
+                continue;
+            }
+
+            if (event->mask & (IN_CREATE | IN_MOVED_TO))
+                ++count;
+            else if (event->mask & (IN_DELETE | IN_MOVED_FROM))
+                --count;
+        }
+    }
+
+    if (needRewatch)
+    {
+        watchTrash();
+        needRescan = true;
+    }
+
+    if (needRescan)
+        rescan();
+    else
+        setItemCount(count);
+}
+
+void TrashService::watchTrash()
+{
+    if (m_inotifyFd < 0)
+        return;
+
+    if (m_trashWatch < 0)
+        m_trashWatch = inotify_add_watch(m_inotifyFd, TrashDir.toLocal8Bit().constData(),
+                                         IN_CREATE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM | IN_ONLYDIR);
+    if (m_infoWatch < 0)
+        m_infoWatch = inotify_add_watch(m_inotifyFd, TrashInfoDir.toLocal8Bit().constData(),
+                                        IN_CREATE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM | IN_ONLYDIR);
+}
+
+void TrashService::rescan()
+{
+    setItemCount(QDir(TrashInfoDir).entryList(QDir::Files | QDir::Hidden | QDir::NoDotAndDotDot).count());
+}
+
+void TrashService::setItemCount(const int count)
+{
+    if (m_itemCount == count)
+        return;
+
+    m_itemCount = count;
+
+    emit itemCountChanged(m_itemCount);
+}
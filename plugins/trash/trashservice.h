@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRASHSERVICE_H
+#define TRASHSERVICE_H
+
+#include <QObject>
+#include <QUrl>
+#include <QSocketNotifier>
+
+///
+/// \brief The TrashService class performs trash operations without blocking the dock,
+/// and keeps the trash item count up to date from inotify events of the info folder.
+///
+class TrashService : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit TrashService(QObject *parent = 0);
+    ~TrashService();
+
+    static const QString trashDir();
+
+    int itemCount() const { return m_itemCount; }
+
+    void moveToTrash(const QList<QUrl> &urls);
+    void uninstallApp(const QString &appKey);
+
+signals:
+    void itemCountChanged(const int count) const;
+
+private slots:
+    void onInotifyEvent();
+
+private:
+    void startTrash(const QStringList &files, const int command = 0);
+    void watchTrash();
+    void rescan();
+    void setItemCount(const int count);
+
+private:
+    int m_inotifyFd;
+    int m_trashWatch;
+    int m_infoWatch;
+    int m_itemCount;
+    QSocketNotifier *m_notifier;
+};
+
+#endif // TRASHSERVICE_H
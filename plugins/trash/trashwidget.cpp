@@ -33,13 +33,15 @@ DWIDGET_USE_NAMESPACE
 TrashWidget::TrashWidget(QWidget *parent)
     : QWidget(parent),
 
-      m_popupApplet(new PopupControlWidget(this))
+      m_trashService(new TrashService(this)),
+      m_popupApplet(new PopupControlWidget(m_trashService, this))
 {
 //    QIcon::setThemeName("deepin");
 
     m_popupApplet->setVisible(false);
 
     connect(m_popupApplet, &PopupControlWidget::emptyChanged, this, &TrashWidget::updateIcon);
+    connect(m_popupApplet, &PopupControlWidget::emptyChanged, this, [=] { m_contextMenu.clear(); });
 
     updateIcon();
     setAcceptDrops(true);
@@ -57,6 +59,10 @@ QSize TrashWidget::sizeHint() const
 
 const QString TrashWidget::contextMenu() const
 {
+    // cached until trash empty state changed
+    if (!m_contextMenu.isNull())
+        return m_contextMenu;
+
     QList<QVariant> items;
     items.reserve(2);
 
@@ -80,7 +86,9 @@ const QString TrashWidget::contextMenu() const
     menu["checkableMenu"] = false;
     menu["singleCheck"] = false;
 
-    return QJsonDocument::fromVariant(menu).toJson();
+    m_contextMenu = QJsonDocument::fromVariant(menu).toJson();
+
+    return m_contextMenu;
 }
 
 int TrashWidget::trashItemCount() const
@@ -110,14 +118,10 @@ void TrashWidget::dragEnterEvent(QDragEnterEvent *e)
 void TrashWidget::dropEvent(QDropEvent *e)
 {
     if (e->mimeData()->hasFormat("RequestDock"))
-        return removeApp(e->mimeData()->data("AppKey"));
+        return m_trashService->uninstallApp(e->mimeData()->data("AppKey"));
 
     if (e->mimeData()->hasFormat("text/uri-list"))
-    {
-        const QMimeData *mime = e->mimeData();
-        for (auto url : mime->urls())
-            moveToTrash(url);
-    }
+        m_trashService->moveToTrash(e->mimeData()->urls());
 }
 
 void TrashWidget::paintEvent(QPaintEvent *e)
@@ -160,27 +164,3 @@ void TrashWidget::updateIcon()
 
     update();
 }
-
-void TrashWidget::removeApp(const QString &appKey)
-{
-    const QString cmd("dbus-send --print-reply --dest=com.deepin.dde.Launcher /com/deepin/dde/Launcher com.deepin.dde.Launcher.UninstallApp string:\"" + appKey + "\"");
-
-    QProcess *proc = new QProcess;
-    proc->start(cmd);
-    proc->waitForFinished();
-
-    proc->deleteLater();
-}
-
-void TrashWidget::moveToTrash(const QUrl &url)
-{
-    const QFileInfo info = url.toLocalFile();
-
-    QProcess::startDetached("gvfs-trash", QStringList() << "-f" << info.absoluteFilePath());
-
-//    QDir trashDir(m_popupApplet->trashDir() + "/files");
-//    if (!trashDir.exists())
-//        trashDir.mkpath(".");
-
-//    QDir().rename(info.absoluteFilePath(), trashDir.absoluteFilePath(info.fileName()));
-}
@@ -23,6 +23,7 @@
 #define TRASHWIDGET_H
 
 #include "popupcontrolwidget.h"
+#include "trashservice.h"
 
 #include <QWidget>
 #include <QPixmap>
@@ -54,14 +55,12 @@ protected:
     void resizeEvent(QResizeEvent *e);
     void mousePressEvent(QMouseEvent *e);
 
-private slots:
-    void removeApp(const QString &appKey);
-    void moveToTrash(const QUrl &url);
-
 private:
+    TrashService *m_trashService;
     PopupControlWidget *m_popupApplet;
 
     QPixmap m_icon;
+    mutable QString m_contextMenu;
 };
 
 #endif // TRASHWIDGET_H
@@ -0,0 +1,532 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fakenetwork.h"
+#include "networkmanager.h"
+#include "panel/mainpanel.h"
+#include "controller/dockpluginscontroller.h"
+#include "item/pluginsitem.h"
+#include "item/components/appsnapshot.h"
+#include "util/hotpathprofiler.h"
+#include "util/imagefactory.h"
+#include "util/themeappicon.h"
+#include "xcb/xcb_timestamp.h"
+
+#include <QtTest>
+#include <QApplication>
+#include <QPainter>
+#include <QX11Info>
+#include <QMimeData>
+#include <QDragEnterEvent>
+#include <QGSettings>
+
+#include <DWindowManagerHelper>
+
+DWIDGET_USE_NAMESPACE
+
+///
+/// \brief The BenchPlugin class adds plain items through the plugin proxy,
+/// like a plugin with many items would.
+///
+class BenchPlugin : public QObject, public PluginsItemInterface
+{
+    Q_OBJECT
+
+public:
+    explicit BenchPlugin(QObject *parent = nullptr) : QObject(parent) {}
+    ~BenchPlugin()
+    {
+        // widgets still in an item belong to it
+        for (auto widget : m_widgets)
+            if (widget && !widget->parent())
+                delete widget.data();
+    }
+
+    const QString pluginName() const override { return "bench"; }
+    void init(PluginProxyInterface *proxyInter) override { m_proxyInter = proxyInter; }
+
+    QWidget *itemWidget(const QString &itemKey) override
+    {
+        QPointer<QWidget> &widget = m_widgets[itemKey];
+        if (!widget)
+        {
+            widget = new QWidget;
+            widget->setFixedSize(24, 24);
+        }
+
+        return widget;
+    }
+
+    // unknown keys sort last, so inserting them walks every plugin item
+    int itemSortKey(const QString &itemKey) override { return m_sortKeys.value(itemKey, m_sortKeys.size() + 1); }
+    void setSortKey(const QString &itemKey, const int order) override { m_sortKeys[itemKey] = order; }
+
+    void setItemCount(const int count)
+    {
+        while (m_keys.size() < count)
+        {
+            const QString key = QString("item%1").arg(m_keys.size());
+            m_keys << key;
+            m_sortKeys[key] = m_keys.size();
+            m_proxyInter->itemAdded(this, key);
+        }
+
+        while (m_keys.size() > count)
+        {
+            const QString key = m_keys.takeLast();
+            m_proxyInter->itemRemoved(this, key);
+            m_sortKeys.remove(key);
+            delete m_widgets.take(key).data();
+        }
+    }
+
+    void reverseSortKeys()
+    {
+        for (auto it(m_sortKeys.begin()); it != m_sortKeys.end(); ++it)
+            it.value() = m_sortKeys.size() + 1 - it.value();
+    }
+
+private:
+    PluginProxyInterface *m_proxyInter = nullptr;
+    QStringList m_keys;
+    QMap<QString, int> m_sortKeys;
+    QMap<QString, QPointer<QWidget>> m_widgets;
+};
+
+///
+/// \brief The BenchSample class times one QBENCHMARK loop and records the
+/// cost of an iteration with the hot path probes, so the json written at
+/// cleanupTestCase holds both.
+///
+class BenchSample
+{
+public:
+    explicit BenchSample() : m_iterations(0) { m_timer.start(); }
+
+    inline void iterate() { ++m_iterations; }
+
+    void record()
+    {
+        const qint64 nsecs = m_timer.nsecsElapsed();
+        if (!m_iterations)
+            return;
+
+        const QByteArray name = QByteArray("bench/") + QTest::currentTestFunction() + "/" + QTest::currentDataTag();
+        HotPathProfiler::record(name.constData(), nsecs / m_iterations);
+    }
+
+private:
+    QElapsedTimer m_timer;
+    qint64 m_iterations;
+};
+
+///
+/// \brief The DockBench class measures the dock hot paths that are also
+/// probed by PROFILE_HOT_PATH, so a regression shows up before release.
+/// results are written as json to DDE_DOCK_PROFILE, or dde-dock-bench.json
+/// in the working directory.
+///
+class DockBench : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void lighterEffect_data();
+    void lighterEffect();
+    void getIcon_data();
+    void getIcon();
+    void reloadDevices_data();
+    void reloadDevices();
+    void timestamp_data();
+    void timestamp();
+    void adjustItemSize_data();
+    void adjustItemSize();
+    void itemAt_data();
+    void itemAt();
+    void pluginItemInserted_data();
+    void pluginItemInserted();
+    void sortPluginItems_data();
+    void sortPluginItems();
+    void fetchSnapshot_data();
+    void fetchSnapshot();
+
+private:
+    void itemCount_data() const;
+    int pluginItemCount() const;
+    void adjustItems() const;
+
+private:
+    FakeNetwork *m_network = nullptr;
+    BenchPlugin *m_plugin = nullptr;
+    MainPanel *m_panel = nullptr;
+    DockItemController *m_controller = nullptr;
+    DockPluginsController *m_pluginsController = nullptr;
+    QTimer *m_adjustTimer = nullptr;
+};
+
+void DockBench::initTestCase()
+{
+    // must be set before the first probe, the profiler reads it once
+    if (qEnvironmentVariableIsEmpty("DDE_DOCK_PROFILE"))
+        qputenv("DDE_DOCK_PROFILE", "dde-dock-bench.json");
+
+    m_network = new FakeNetwork(this);
+    if (!m_network->registerService())
+        QSKIP("session bus is not available, run the bench under dbus-run-session");
+
+    // the panel cases need the dock settings, the others run without them
+    if (!QGSettings::isSchemaInstalled("com.deepin.dde.dock"))
+        return;
+
+    m_panel = new MainPanel;
+    m_panel->resize(1920, 48);
+    m_panel->updateDockPosition(Dock::Bottom);
+    m_panel->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_panel));
+
+    m_controller = DockItemController::instance(m_panel);
+    m_pluginsController = m_controller->findChild<DockPluginsController *>();
+    QVERIFY(m_pluginsController);
+
+    m_plugin = new BenchPlugin(this);
+    m_plugin->init(m_pluginsController);
+
+    // the panel only adjusts from its own timer, so drive that one
+    for (auto timer : m_panel->findChildren<QTimer *>(QString(), Qt::FindDirectChildrenOnly))
+        if (timer->isSingleShot() && timer->interval() == 100)
+            m_adjustTimer = timer;
+    QVERIFY(m_adjustTimer);
+}
+
+void DockBench::cleanupTestCase()
+{
+    // items are children of the panel and must go before the plugin
+    delete m_panel;
+
+    HotPathProfiler::dump();
+}
+
+void DockBench::lighterEffect_data()
+{
+    QTest::addColumn<int>("size");
+
+    QTest::newRow("32px") << 32;
+    QTest::newRow("48px") << 48;
+    QTest::newRow("96px") << 96;
+}
+
+void DockBench::lighterEffect()
+{
+    QFETCH(int, size);
+
+    QPixmap source(size, size);
+    source.fill(QColor(30, 120, 200));
+
+    BenchSample sample;
+    QBENCHMARK {
+        const QPixmap result = ImageFactory::lighterEffect(source);
+        Q_UNUSED(result);
+        sample.iterate();
+    }
+    sample.record();
+}
+
+void DockBench::getIcon_data()
+{
+    QTest::addColumn<QString>("iconName");
+    QTest::addColumn<int>("size");
+
+    QTest::newRow("theme icon") << "application-x-executable" << 48;
+    QTest::newRow("missing icon") << "dde-dock-bench-missing-icon" << 48;
+}
+
+void DockBench::getIcon()
+{
+    QFETCH(QString, iconName);
+    QFETCH(int, size);
+
+    BenchSample sample;
+    QBENCHMARK {
+        const QPixmap result = ThemeAppIcon::getIcon(iconName, size);
+        Q_UNUSED(result);
+        sample.iterate();
+    }
+    sample.record();
+}
+
+void DockBench::reloadDevices_data()
+{
+    QTest::addColumn<int>("wired");
+    QTest::addColumn<int>("wireless");
+
+    QTest::newRow("1 wired, 1 wireless") << 1 << 1;
+    QTest::newRow("4 wired, 4 wireless") << 4 << 4;
+    QTest::newRow("100 wired, 100 wireless") << 100 << 100;
+    QTest::newRow("250 wired, 250 wireless") << 250 << 250;
+}
+
+void DockBench::reloadDevices()
+{
+    QFETCH(int, wired);
+    QFETCH(int, wireless);
+
+    NetworkManager *manager = NetworkManager::instance(this);
+
+    // alternate generations so every reload sees changed devices
+    int generation = 0;
+    BenchSample sample;
+    QBENCHMARK {
+        m_network->setDevices(wired, wireless, ++generation);
+        QVERIFY(QMetaObject::invokeMethod(manager, "reloadDevices", Qt::DirectConnection));
+        sample.iterate();
+    }
+    sample.record();
+
+    QCOMPARE(manager->deviceList().size(), wired + wireless);
+}
+
+void DockBench::timestamp_data()
+{
+    QTest::addColumn<bool>("cached");
+
+    QTest::newRow("QX11Info::getTimestamp") << false;
+    QTest::newRow("XcbTimestamp") << true;
+}
+
+///
+/// \brief DockBench::timestamp compares the blocking server round trip the
+/// app item used to make per action with the time cached from input events.
+///
+void DockBench::timestamp()
+{
+    QFETCH(bool, cached);
+
+    if (!QX11Info::isPlatformX11())
+        QSKIP("timestamps need an X server, run the bench under xvfb-run");
+
+    // the first call asks the server, like the first action before any input
+    XcbTimestamp::instance()->timestamp();
+
+    xcb_timestamp_t time = XCB_CURRENT_TIME;
+    BenchSample sample;
+    QBENCHMARK {
+        time = cached ? XcbTimestamp::instance()->timestamp() : QX11Info::getTimestamp();
+        sample.iterate();
+    }
+    sample.record();
+
+    QVERIFY(time != XCB_CURRENT_TIME);
+}
+
+void DockBench::adjustItemSize_data()
+{
+    itemCount_data();
+}
+
+///
+/// \brief DockBench::adjustItemSize one timer driven size pass over a
+/// panel holding count plugin items.
+///
+void DockBench::adjustItemSize()
+{
+    QFETCH(int, count);
+
+    if (!m_panel)
+        QSKIP("the com.deepin.dde.dock schema is not installed");
+
+    m_plugin->setItemCount(count);
+    QTRY_COMPARE(pluginItemCount(), count);
+
+    BenchSample sample;
+    QBENCHMARK {
+        adjustItems();
+        sample.iterate();
+    }
+    sample.record();
+}
+
+void DockBench::itemAt_data()
+{
+    itemCount_data();
+}
+
+///
+/// \brief DockBench::itemAt hit test the last item, drag enter without a
+/// source or dock request returns right after the lookup.
+///
+void DockBench::itemAt()
+{
+    QFETCH(int, count);
+
+    if (!m_panel)
+        QSKIP("the com.deepin.dde.dock schema is not installed");
+
+    m_plugin->setItemCount(count);
+    QTRY_COMPARE(pluginItemCount(), count);
+    adjustItems();
+
+    DockItem *last = m_controller->itemList().last();
+    QTRY_VERIFY(last->isVisible());
+
+    QMimeData mime;
+    const QPoint pos = last->geometry().center();
+
+    BenchSample sample;
+    QBENCHMARK {
+        QDragEnterEvent e(pos, Qt::MoveAction, &mime, Qt::LeftButton, Qt::NoModifier);
+        QApplication::sendEvent(m_panel, &e);
+        sample.iterate();
+    }
+    sample.record();
+}
+
+void DockBench::pluginItemInserted_data()
+{
+    itemCount_data();
+}
+
+///
+/// \brief DockBench::pluginItemInserted insert and remove one item that
+/// sorts after count others, through the same queued signals the plugins
+/// controller uses.
+///
+void DockBench::pluginItemInserted()
+{
+    QFETCH(int, count);
+
+    if (!m_panel)
+        QSKIP("the com.deepin.dde.dock schema is not installed");
+
+    m_plugin->setItemCount(count);
+    QTRY_COMPARE(pluginItemCount(), count);
+
+    PluginsItem *item = new PluginsItem(m_plugin, "extra");
+
+    BenchSample sample;
+    QBENCHMARK {
+        emit m_pluginsController->pluginItemInserted(item);
+        QCoreApplication::processEvents();
+        emit m_pluginsController->pluginItemRemoved(item);
+        QCoreApplication::processEvents();
+        sample.iterate();
+    }
+    sample.record();
+
+    QCOMPARE(pluginItemCount(), count);
+    delete item;
+}
+
+void DockBench::sortPluginItems_data()
+{
+    itemCount_data();
+}
+
+///
+/// \brief DockBench::sortPluginItems sort count plugin items whose keys are
+/// reversed on every iteration, so each pass moves every item.
+///
+void DockBench::sortPluginItems()
+{
+    QFETCH(int, count);
+
+    if (!m_panel)
+        QSKIP("the com.deepin.dde.dock schema is not installed");
+
+    m_plugin->setItemCount(count);
+    QTRY_COMPARE(pluginItemCount(), count);
+
+    BenchSample sample;
+    QBENCHMARK {
+        m_plugin->reverseSortKeys();
+        m_controller->sortPluginItems();
+        sample.iterate();
+    }
+    sample.record();
+}
+
+void DockBench::fetchSnapshot_data()
+{
+    QTest::addColumn<QSize>("size");
+
+    QTest::newRow("400x300") << QSize(400, 300);
+    QTest::newRow("1920x1080") << QSize(1920, 1080);
+}
+
+void DockBench::fetchSnapshot()
+{
+    QFETCH(QSize, size);
+
+    if (!QX11Info::isPlatformX11() || !DWindowManagerHelper::instance()->hasComposite())
+        QSKIP("snapshots are only taken under a compositing window manager");
+
+    QWidget window;
+    window.setAutoFillBackground(true);
+    window.resize(size);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+    AppSnapshot snapshot(window.winId());
+
+    BenchSample sample;
+    QBENCHMARK {
+        snapshot.fetchSnapshot();
+        sample.iterate();
+    }
+    sample.record();
+
+    QVERIFY(!snapshot.snapshot().isNull());
+}
+
+void DockBench::itemCount_data() const
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("10 items") << 10;
+    QTest::newRow("100 items") << 100;
+    QTest::newRow("500 items") << 500;
+}
+
+int DockBench::pluginItemCount() const
+{
+    int count = 0;
+    for (auto item : m_controller->itemList())
+        if (item && item->accessibleName().startsWith(m_plugin->pluginName() + "-"))
+            ++count;
+
+    return count;
+}
+
+///
+/// \brief DockBench::adjustItems fire the panel adjust timer and run the
+/// queued size pass it triggers.
+///
+void DockBench::adjustItems() const
+{
+    QMetaObject::invokeMethod(m_adjustTimer, "timeout");
+    QCoreApplication::processEvents();
+}
+
+QTEST_MAIN(DockBench)
+
+#include "dockbench.moc"
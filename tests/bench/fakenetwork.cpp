@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fakenetwork.h"
+
+#include <QDBusConnection>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QJsonDocument>
+
+static QJsonObject deviceInfo(const QString &type, const int index, const int generation, const int state)
+{
+    QJsonObject info;
+    info["Path"] = FakeNetwork::devicePath(type, index);
+    info["HwAddress"] = QString("00:16:3e:00:%1:%2").arg(index, 2, 10, QChar('0')).arg(generation % 100, 2, 10, QChar('0'));
+    info["State"] = state;
+    info["Vendor"] = "bench";
+
+    return info;
+}
+
+FakeNetwork::FakeNetwork(QObject *parent)
+    : QObject(parent),
+
+      m_activeConnections("{}"),
+      m_activeConnectionInfo("[]"),
+      m_state(70)
+{
+    setDevices(1, 1, 0);
+}
+
+bool FakeNetwork::registerService()
+{
+    QDBusConnection bus = QDBusConnection::sessionBus();
+
+    return bus.registerService("com.deepin.daemon.Network") &&
+           bus.registerObject("/com/deepin/daemon/Network", this, QDBusConnection::ExportAllProperties |
+                                                                  QDBusConnection::ExportAllSlots);
+}
+
+const QString FakeNetwork::devicePath(const QString &type, const int index)
+{
+    return QString("/org/freedesktop/NetworkManager/Devices/%1%2").arg(type).arg(index);
+}
+
+///
+/// \brief FakeNetwork::setDevices publish a device list, a different
+/// generation changes the device info so listeners see updates.
+///
+void FakeNetwork::setDevices(const int wiredCount, const int wirelessCount, const int generation, const int deviceState)
+{
+    QJsonArray wired;
+    for (int i(0); i != wiredCount; ++i)
+        wired.append(deviceInfo("wired", i, generation, deviceState));
+
+    QJsonArray wireless;
+    for (int i(0); i != wirelessCount; ++i)
+        wireless.append(deviceInfo("wireless", i, generation, deviceState));
+
+    QJsonObject devices;
+    devices["wired"] = wired;
+    devices["wireless"] = wireless;
+
+    m_devices = QString::fromUtf8(QJsonDocument(devices).toJson(QJsonDocument::Compact));
+}
+
+///
+/// \brief FakeNetwork::setActiveConnection publish one active connection
+/// of type on devicePath.
+///
+void FakeNetwork::setActiveConnection(const QString &type, const QString &devicePath)
+{
+    QJsonObject connection;
+    connection["Uuid"] = "6fa0ed5a-40c4-4ab8-9bbb-3f2b7c3a0c11";
+    connection["Devices"] = QJsonArray() << devicePath;
+
+    QJsonObject connections;
+    connections["/org/freedesktop/NetworkManager/ActiveConnection/0"] = connection;
+
+    QJsonObject info;
+    info["ConnectionType"] = type;
+    info["Device"] = devicePath;
+
+    m_activeConnections = QString::fromUtf8(QJsonDocument(connections).toJson(QJsonDocument::Compact));
+    m_activeConnectionInfo = QString::fromUtf8(QJsonDocument(QJsonArray() << info).toJson(QJsonDocument::Compact));
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FAKENETWORK_H
+#define FAKENETWORK_H
+
+#include <QObject>
+#include <QString>
+#include <QDBusObjectPath>
+
+///
+/// \brief The FakeNetwork class stands in for the network daemon, it is
+/// registered on the session bus of the benchmark process so NetworkManager
+/// reads its properties through the real DBusNetwork proxy. the network
+/// tests use it too, to put device items into the connecting state.
+///
+class FakeNetwork : public QObject
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "com.deepin.daemon.Network")
+    Q_PROPERTY(QString Devices READ devices)
+    Q_PROPERTY(QString ActiveConnections READ activeConnections)
+    Q_PROPERTY(uint State READ state)
+
+public:
+    explicit FakeNetwork(QObject *parent = nullptr);
+
+    bool registerService();
+
+    inline QString devices() const { return m_devices; }
+    inline QString activeConnections() const { return m_activeConnections; }
+    inline uint state() const { return m_state; }
+
+    static const QString devicePath(const QString &type, const int index);
+
+    void setDevices(const int wiredCount, const int wirelessCount, const int generation, const int deviceState = 100);
+    void setActiveConnection(const QString &type, const QString &devicePath);
+    inline void setState(const uint state) { m_state = state; }
+
+public slots:
+    QString GetActiveConnectionInfo() const { return m_activeConnectionInfo; }
+    QString GetAccessPoints(const QDBusObjectPath &device) const { Q_UNUSED(device); return QStringLiteral("[]"); }
+    bool IsDeviceEnabled(const QDBusObjectPath &device) const { Q_UNUSED(device); return true; }
+
+private:
+    QString m_devices;
+    QString m_activeConnections;
+    QString m_activeConnectionInfo;
+    uint m_state;
+};
+
+#endif // FAKENETWORK_H
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "controller/dockitemcontroller.h"
+#include "item/appitem.h"
+
+#include <QtTest>
+#include <QApplication>
+#include <QDBusConnection>
+#include <QDBusConnectionInterface>
+#include <QDBusMessage>
+#include <QProcess>
+#include <QGSettings>
+
+#define MOCK_SERVICE    "com.deepin.dde.DockMock"
+
+///
+/// \brief The DockItemControllerTest class drives the item controller against
+/// dde-dock-mock-daemon, so the D-Bus calls it makes can be counted.
+///
+class DockItemControllerTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void dragAcrossDock_data();
+    void dragAcrossDock();
+
+private:
+    const QList<AppItem *> apps() const;
+    const QStringList localIds() const;
+    const QStringList daemonIds() const;
+    const QDBusMessage mock(const QString &method, const QVariantList &args = QVariantList()) const;
+
+private:
+    QProcess m_daemon;
+    DockItemController *m_controller = nullptr;
+    int m_lateEntries = 0;
+};
+
+void DockItemControllerTest::initTestCase()
+{
+    if (!QGSettings::isSchemaInstalled("com.deepin.dde.dock"))
+        QSKIP("the com.deepin.dde.dock schema is not installed");
+
+    m_daemon.start(MOCK_DAEMON_PATH, QStringList());
+    QVERIFY(m_daemon.waitForStarted());
+    QTRY_VERIFY(QDBusConnection::sessionBus().interface()->isServiceRegistered(MOCK_SERVICE));
+
+    mock("SetEntryCount", QVariantList() << 60);
+
+    m_controller = DockItemController::instance(this);
+    QTRY_COMPARE(apps().size(), 60);
+    QCOMPARE(localIds(), daemonIds());
+}
+
+void DockItemControllerTest::cleanupTestCase()
+{
+    m_daemon.kill();
+    m_daemon.waitForFinished();
+}
+
+void DockItemControllerTest::dragAcrossDock_data()
+{
+    QTest::addColumn<bool>("commit");
+    QTest::addColumn<bool>("mutate");
+
+    QTest::newRow("drop") << true << false;
+    QTest::newRow("cancel") << false << false;
+    QTest::newRow("drop, entries change meanwhile") << true << true;
+    QTest::newRow("cancel, entries change meanwhile") << false << true;
+}
+
+///
+/// \brief DockItemControllerTest::dragAcrossDock walk one app over 50 others,
+/// the daemon must see a single MoveEntry on drop, none on cancel, and end
+/// up in the same order as the panel even if entries come and go mid-drag.
+///
+void DockItemControllerTest::dragAcrossDock()
+{
+    QFETCH(bool, commit);
+    QFETCH(bool, mutate);
+
+    mock("ResetCallCounts");
+
+    DockItem *dragged = apps().at(5);
+    m_controller->beginDragSession(dragged);
+
+    for (int i(0); i != 50; ++i)
+    {
+        const QList<QPointer<DockItem>> items = m_controller->itemList();
+        m_controller->itemMove(dragged, items.at(items.indexOf(dragged) + 1));
+    }
+
+    if (mutate)
+    {
+        // one entry leaves before the origin, another arrives at the front
+        mock("RemoveEntry", QVariantList() << apps().first()->appId());
+        QTRY_COMPARE(apps().size(), 59);
+
+        mock("AddEntry", QVariantList() << QString("late%1").arg(++m_lateEntries) << 0);
+        QTRY_COMPARE(apps().size(), 60);
+    }
+
+    m_controller->finishDragSession(commit);
+
+    // the daemon handles calls in order, so the count is final once it answers
+    const QDBusMessage calls = mock("CallCount", QVariantList() << "MoveEntry");
+    QCOMPARE(calls.arguments().value(0).toInt(), commit ? 1 : 0);
+    QCOMPARE(localIds(), daemonIds());
+}
+
+const QList<AppItem *> DockItemControllerTest::apps() const
+{
+    QList<AppItem *> result;
+    for (auto item : m_controller->itemList())
+        if (item && item->itemType() == DockItem::App)
+            result << static_cast<AppItem *>(item.data());
+
+    return result;
+}
+
+const QStringList DockItemControllerTest::localIds() const
+{
+    QStringList ids;
+    for (auto *app : apps())
+        ids << app->appId();
+
+    return ids;
+}
+
+const QStringList DockItemControllerTest::daemonIds() const
+{
+    const QDBusMessage msg = QDBusMessage::createMethodCall("com.deepin.dde.daemon.Dock", "/com/deepin/dde/daemon/Dock",
+                                                            "com.deepin.dde.daemon.Dock", "GetEntryIDs");
+
+    return QDBusConnection::sessionBus().call(msg).arguments().value(0).toStringList();
+}
+
+const QDBusMessage DockItemControllerTest::mock(const QString &method, const QVariantList &args) const
+{
+    QDBusMessage msg = QDBusMessage::createMethodCall(MOCK_SERVICE, "/com/deepin/dde/DockMock", MOCK_SERVICE, method);
+    msg.setArguments(args);
+
+    return QDBusConnection::sessionBus().call(msg);
+}
+
+QTEST_MAIN(DockItemControllerTest)
+
+#include "dockitemcontrollertest.moc"
@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "util/docksettings.h"
+#include "controller/dockitemcontroller.h"
+#include "item/appitem.h"
+#include "item/placeholderitem.h"
+#include "panel/mainpanel.h"
+
+#include <QtTest>
+#include <QApplication>
+#include <QDBusConnection>
+#include <QDBusConnectionInterface>
+#include <QDBusMessage>
+#include <QDBusVariant>
+#include <QProcess>
+#include <QGSettings>
+
+#define MOCK_SERVICE    "com.deepin.dde.DockMock"
+#define ENTRY_COUNT     100
+
+Q_DECLARE_METATYPE(WindowConfig)
+
+///
+/// \brief The DockSettingsTest class checks the window size calculation and
+/// the per-type item counts DockSettings keeps from the controller signals.
+///
+class DockSettingsTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void windowSize_data();
+    void windowSize();
+    void itemCount_data();
+    void itemCount();
+    void itemChurn();
+
+private:
+    static const WindowConfig config(const DisplayMode mode, const Position position, const int count, const int itemSize);
+
+    int appCount() const;
+    const QSize expectedWindowSize() const;
+    const QDBusMessage mock(const QString &method, const QVariantList &args = QVariantList()) const;
+
+private:
+    QProcess m_daemon;
+    DockItemController *m_controller = nullptr;
+    DockSettings *m_settings = nullptr;
+    int m_addedEntries = 0;
+};
+
+void DockSettingsTest::initTestCase()
+{
+    // windowSize needs nothing, the other cases skip without a daemon
+    if (!QGSettings::isSchemaInstalled("com.deepin.dde.dock"))
+        return;
+
+    m_daemon.start(MOCK_DAEMON_PATH, QStringList());
+    QVERIFY(m_daemon.waitForStarted());
+    QTRY_VERIFY(QDBusConnection::sessionBus().interface()->isServiceRegistered(MOCK_SERVICE));
+
+    // fashion mode is the one where the item count matters
+    QDBusMessage set = QDBusMessage::createMethodCall("com.deepin.dde.daemon.Dock", "/com/deepin/dde/daemon/Dock",
+                                                      "org.freedesktop.DBus.Properties", "Set");
+    set << "com.deepin.dde.daemon.Dock" << "DisplayMode" << QVariant::fromValue(QDBusVariant(int(Dock::Fashion)));
+    QDBusConnection::sessionBus().call(set);
+
+    mock("SetEntryCount", QVariantList() << ENTRY_COUNT);
+
+    m_controller = DockItemController::instance(this);
+    QTRY_COMPARE(appCount(), ENTRY_COUNT);
+
+    m_settings = new DockSettings;
+    QTRY_COMPARE(m_settings->displayMode(), Dock::Fashion);
+}
+
+void DockSettingsTest::cleanupTestCase()
+{
+    m_daemon.kill();
+    m_daemon.waitForFinished();
+}
+
+void DockSettingsTest::windowSize_data()
+{
+    QTest::addColumn<WindowConfig>("config");
+    QTest::addColumn<QSize>("size");
+
+    // 1920x1080 primary, fashion mode keeps FASHION_MODE_PADDING off both ends
+    QTest::newRow("efficient bottom") << config(Efficient, Bottom, 0, 48) << QSize(1920, 48 + PANEL_BORDER + WINDOW_OVERFLOW);
+    QTest::newRow("efficient top, count ignored") << config(Efficient, Top, 30, 48) << QSize(1920, 48 + PANEL_BORDER + WINDOW_OVERFLOW);
+    QTest::newRow("efficient left") << config(Efficient, Left, 0, 48) << QSize(48 + PANEL_BORDER + WINDOW_OVERFLOW, 1080);
+    QTest::newRow("efficient right") << config(Efficient, Right, 0, 48) << QSize(48 + PANEL_BORDER + WINDOW_OVERFLOW, 1080);
+    QTest::newRow("fashion bottom, empty") << config(Fashion, Bottom, 0, 48) << QSize(PANEL_MARGIN * 2, 48 + PANEL_BORDER);
+    QTest::newRow("fashion bottom, 10 items") << config(Fashion, Bottom, 10, 48) << QSize(480 + PANEL_MARGIN * 2, 48 + PANEL_BORDER);
+    QTest::newRow("fashion top, 10 small items") << config(Fashion, Top, 10, 32) << QSize(320 + PANEL_MARGIN * 2, 32 + PANEL_BORDER);
+    QTest::newRow("fashion bottom, 100 items") << config(Fashion, Bottom, 100, 48) << QSize(1920 - 60, 48 + PANEL_BORDER);
+    QTest::newRow("fashion left, 10 items") << config(Fashion, Left, 10, 48) << QSize(48 + PANEL_BORDER, 480 + PANEL_MARGIN * 2);
+    QTest::newRow("fashion right, 100 items") << config(Fashion, Right, 100, 48) << QSize(48 + PANEL_BORDER, 1080 - 60);
+}
+
+void DockSettingsTest::windowSize()
+{
+    QFETCH(WindowConfig, config);
+    QFETCH(QSize, size);
+
+    QCOMPARE(DockSettings::calculateWindowSize(config), size);
+}
+
+void DockSettingsTest::itemCount_data()
+{
+    QTest::addColumn<int>("add");
+    QTest::addColumn<int>("remove");
+    QTest::addColumn<bool>("placeholder");
+
+    QTest::newRow("add one app") << 1 << 0 << false;
+    QTest::newRow("add five apps") << 5 << 0 << false;
+    QTest::newRow("remove one app") << 0 << 1 << false;
+    QTest::newRow("remove five apps") << 0 << 5 << false;
+    QTest::newRow("add and remove") << 3 << 3 << false;
+    QTest::newRow("placeholder") << 0 << 0 << true;
+    QTest::newRow("placeholder and apps") << 2 << 1 << true;
+}
+
+void DockSettingsTest::itemCount()
+{
+    if (!m_settings)
+        QSKIP("the com.deepin.dde.dock schema is not installed");
+
+    QFETCH(int, add);
+    QFETCH(int, remove);
+    QFETCH(bool, placeholder);
+
+    const int start = appCount();
+    for (int i(0); i != add; ++i)
+        mock("AddEntry", QVariantList() << QString("count%1").arg(++m_addedEntries) << -1);
+    QTRY_COMPARE(appCount(), start + add);
+
+    for (int i(0); i != remove; ++i)
+    {
+        const int current = appCount();
+        for (auto item : m_controller->itemList())
+        {
+            if (item && item->itemType() == DockItem::App)
+            {
+                mock("RemoveEntry", QVariantList() << static_cast<AppItem *>(item.data())->appId());
+                break;
+            }
+        }
+        QTRY_COMPARE(appCount(), current - 1);
+    }
+
+    PlaceholderItem *ph = nullptr;
+    if (placeholder)
+    {
+        ph = new PlaceholderItem;
+        m_controller->placeholderItemAdded(ph, m_controller->itemList().last());
+    }
+
+    // every type matches a walk of the list
+    QHash<DockItem::ItemType, int> walked;
+    for (auto item : m_controller->itemList())
+        ++walked[item->itemType()];
+    for (auto type : { DockItem::Launcher, DockItem::App, DockItem::Stretch, DockItem::Plugins, DockItem::Container, DockItem::Placeholder })
+        QCOMPARE(m_settings->itemCount(type), walked.value(type));
+
+    // the size follows once the queued recalculation ran
+    QTRY_COMPARE(m_settings->windowSize(), expectedWindowSize());
+
+    if (ph)
+    {
+        m_controller->placeholderItemRemoved(ph);
+        delete ph;
+
+        QCOMPARE(m_settings->itemCount(DockItem::Placeholder), 0);
+        QTRY_COMPARE(m_settings->windowSize(), expectedWindowSize());
+    }
+}
+
+///
+/// \brief DockSettingsTest::itemChurn a placeholder coming and going on a
+/// dock with 100 apps, the cost of one insert and one remove round trip.
+///
+void DockSettingsTest::itemChurn()
+{
+    if (!m_settings)
+        QSKIP("the com.deepin.dde.dock schema is not installed");
+
+    QTRY_VERIFY(appCount() >= ENTRY_COUNT - 5);
+
+    PlaceholderItem ph;
+    const QSize before = m_settings->windowSize();
+
+    QBENCHMARK {
+        m_controller->placeholderItemAdded(&ph, m_controller->itemList().last());
+        m_controller->placeholderItemRemoved(&ph);
+        QCoreApplication::processEvents();
+    }
+
+    QCOMPARE(m_settings->itemCount(DockItem::Placeholder), 0);
+    QCOMPARE(m_settings->windowSize(), before);
+}
+
+const WindowConfig DockSettingsTest::config(const DisplayMode mode, const Position position, const int count, const int itemSize)
+{
+    WindowConfig c;
+    c.displayMode = mode;
+    c.position = position;
+    c.visibleItemCount = count;
+    c.itemWidth = itemSize;
+    c.itemHeight = itemSize;
+    c.primarySize = QSize(1920, 1080);
+
+    return c;
+}
+
+int DockSettingsTest::appCount() const
+{
+    int count = 0;
+    for (auto item : m_controller->itemList())
+        if (item && item->itemType() == DockItem::App)
+            ++count;
+
+    return count;
+}
+
+const QSize DockSettingsTest::expectedWindowSize() const
+{
+    int visible = 0;
+    for (auto item : m_controller->itemList())
+    {
+        switch (item->itemType())
+        {
+        case DockItem::Launcher:
+        case DockItem::App:
+        case DockItem::Plugins:
+        case DockItem::Placeholder:
+            ++visible;
+            break;
+        default:;
+        }
+    }
+
+    const qreal ratio = qApp->devicePixelRatio();
+    WindowConfig c = config(m_settings->displayMode(), m_settings->position(), visible, 0);
+    c.itemWidth = std::round(AppItem::itemBaseWidth() / ratio);
+    c.itemHeight = std::round(AppItem::itemBaseHeight() / ratio);
+    c.primarySize = m_settings->primaryRect().size();
+
+    return DockSettings::calculateWindowSize(c);
+}
+
+const QDBusMessage DockSettingsTest::mock(const QString &method, const QVariantList &args) const
+{
+    QDBusMessage msg = QDBusMessage::createMethodCall(MOCK_SERVICE, "/com/deepin/dde/DockMock", MOCK_SERVICE, method);
+    msg.setArguments(args);
+
+    return QDBusConnection::sessionBus().call(msg);
+}
+
+QTEST_MAIN(DockSettingsTest)
+
+#include "docksettingstest.moc"
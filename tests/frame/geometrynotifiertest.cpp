@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "util/geometrynotifier.h"
+
+#include <QtTest>
+#include <QWidget>
+#include <QPropertyAnimation>
+
+#define SETTLE_INTERVAL     200
+#define ANIMATION_DURATION  300
+
+///
+/// \brief The GeometryNotifierTest class animates a top level window the way
+/// MainWindow does and counts the settled notifications the dock adaptor
+/// would send for it.
+///
+class GeometryNotifierTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void animation_data();
+    void animation();
+    void roundTrip();
+
+private:
+    bool eventFilter(QObject *o, QEvent *e) override;
+    void animate(const QRect &to);
+
+private:
+    QWidget *m_window = nullptr;
+    GeometryNotifier *m_notifier = nullptr;
+};
+
+void GeometryNotifierTest::init()
+{
+    m_window = new QWidget(nullptr, Qt::FramelessWindowHint);
+    m_window->setGeometry(0, 0, 800, 60);
+    m_window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_window));
+
+    // same feed as MainWindow::event, created after show so the initial rect is not counted
+    m_notifier = new GeometryNotifier(SETTLE_INTERVAL, m_window);
+    m_notifier->update(m_window->geometry());
+    QTest::qWait(SETTLE_INTERVAL * 2);
+    m_window->installEventFilter(this);
+}
+
+void GeometryNotifierTest::cleanup()
+{
+    delete m_window;
+    m_window = nullptr;
+    m_notifier = nullptr;
+}
+
+void GeometryNotifierTest::animation_data()
+{
+    QTest::addColumn<QRect>("to");
+
+    // the panel inside keeps the same local geometry for top <-> bottom,
+    // only the global window rect tells them apart
+    QTest::newRow("top to bottom") << QRect(0, 540, 800, 60);
+    QTest::newRow("top to left") << QRect(0, 0, 60, 600);
+    QTest::newRow("hide") << QRect(0, 0, 800, 2);
+    QTest::newRow("resize") << QRect(0, 0, 600, 60);
+}
+
+void GeometryNotifierTest::animation()
+{
+    QFETCH(QRect, to);
+
+    QSignalSpy spy(m_notifier, &GeometryNotifier::geometrySettled);
+    animate(to);
+
+    QTRY_COMPARE(spy.count(), 1);
+    QTest::qWait(SETTLE_INTERVAL * 2);
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(spy.first().first().toRect(), to);
+    QCOMPARE(m_notifier->published(), m_window->geometry());
+}
+
+void GeometryNotifierTest::roundTrip()
+{
+    QSignalSpy spy(m_notifier, &GeometryNotifier::geometrySettled);
+    const QRect top = m_window->geometry();
+    const QRect bottom(0, 540, 800, 60);
+
+    animate(bottom);
+    QTRY_COMPARE(spy.count(), 1);
+    animate(top);
+    QTRY_COMPARE(spy.count(), 2);
+    QCOMPARE(spy.last().first().toRect(), top);
+
+    // there and back again before settling is no change at all
+    animate(bottom);
+    animate(top);
+    QTest::qWait(SETTLE_INTERVAL * 2);
+    QCOMPARE(spy.count(), 2);
+}
+
+bool GeometryNotifierTest::eventFilter(QObject *o, QEvent *e)
+{
+    if (o == m_window && (e->type() == QEvent::Move || e->type() == QEvent::Resize))
+        m_notifier->update(m_window->geometry());
+
+    return QObject::eventFilter(o, e);
+}
+
+void GeometryNotifierTest::animate(const QRect &to)
+{
+    QPropertyAnimation ani(m_window, "geometry");
+    ani.setDuration(ANIMATION_DURATION);
+    ani.setEndValue(to);
+    ani.start();
+
+    // every frame arrives well inside the settle interval
+    QTRY_COMPARE(ani.state(), QAbstractAnimation::Stopped);
+}
+
+QTEST_MAIN(GeometryNotifierTest)
+
+#include "geometrynotifiertest.moc"
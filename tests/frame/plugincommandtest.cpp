@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "item/pluginsitem.h"
+#include "pluginsiteminterface.h"
+
+#include <QtTest>
+#include <QDBusConnection>
+#include <QDBusConnectionInterface>
+
+#define RECEIVER_SERVICE    "com.deepin.dde.DockCommandTest"
+#define RECEIVER_PATH       "/com/deepin/dde/DockCommandTest"
+
+///
+/// \brief The CommandReceiver class stands in for the service a plugin item
+/// opens, it lives on its own bus connection so calls really cross the bus.
+///
+class CommandReceiver : public QObject
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", RECEIVER_SERVICE)
+
+public:
+    inline const QString lastArgument() const { return m_lastArgument; }
+
+signals:
+    void called() const;
+
+public slots:
+    Q_SCRIPTABLE void Show(const QString &module) { m_lastArgument = module; emit called(); }
+
+private:
+    QString m_lastArgument;
+};
+
+///
+/// \brief The CommandPlugin class is a plugin with both click paths, the
+/// structured one is only visible when \a structured is set.
+///
+class CommandPlugin : public QObject, public PluginsItemInterface
+{
+    Q_OBJECT
+
+public:
+    explicit CommandPlugin(const bool structured) : m_structured(structured), m_widget(new QWidget) {}
+    ~CommandPlugin() { delete m_widget; }
+
+    const QString pluginName() const override { return "command-test"; }
+    void init(PluginProxyInterface *proxyInter) override { m_proxyInter = proxyInter; }
+    QWidget *itemWidget(const QString &itemKey) override { Q_UNUSED(itemKey); return m_widget; }
+
+    const QString itemCommand(const QString &itemKey) override
+    {
+        Q_UNUSED(itemKey);
+
+        ++m_commandCalls;
+        return "dbus-send --print-reply --dest=" RECEIVER_SERVICE " " RECEIVER_PATH " " RECEIVER_SERVICE ".Show \"string:power\"";
+    }
+
+    Q_INVOKABLE QVariantMap itemCommandDescriptor(const QString &itemKey)
+    {
+        Q_UNUSED(itemKey);
+
+        QVariantMap descriptor;
+        if (!m_structured)
+            return descriptor;
+
+        descriptor["service"] = RECEIVER_SERVICE;
+        descriptor["path"] = RECEIVER_PATH;
+        descriptor["interface"] = RECEIVER_SERVICE;
+        descriptor["method"] = "Show";
+        descriptor["arguments"] = QVariantList() << "power";
+
+        return descriptor;
+    }
+
+    inline int commandCalls() const { return m_commandCalls; }
+
+private:
+    const bool m_structured;
+    int m_commandCalls = 0;
+    // the item takes ownership, it may be gone before the plugin
+    QPointer<QWidget> m_widget;
+};
+
+///
+/// \brief The PluginCommandTest class measures click to call latency of
+/// plugin item commands on the private session bus of the test.
+///
+class PluginCommandTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void clickLatency_data();
+    void clickLatency();
+
+private:
+    CommandReceiver m_receiver;
+};
+
+void PluginCommandTest::initTestCase()
+{
+    QDBusConnection bus = QDBusConnection::connectToBus(QDBusConnection::SessionBus, "dock-command-receiver");
+    QVERIFY(bus.isConnected());
+    QVERIFY(bus.registerObject(RECEIVER_PATH, &m_receiver, QDBusConnection::ExportScriptableSlots));
+    QVERIFY(bus.registerService(RECEIVER_SERVICE));
+    QTRY_VERIFY(QDBusConnection::sessionBus().interface()->isServiceRegistered(RECEIVER_SERVICE));
+}
+
+void PluginCommandTest::cleanupTestCase()
+{
+    QDBusConnection::disconnectFromBus("dock-command-receiver");
+}
+
+void PluginCommandTest::clickLatency_data()
+{
+    QTest::addColumn<bool>("structured");
+
+    QTest::newRow("descriptor") << true;
+    QTest::newRow("dbus-send command") << false;
+}
+
+void PluginCommandTest::clickLatency()
+{
+    QFETCH(bool, structured);
+
+    CommandPlugin plugin(structured);
+    PluginsItem item(&plugin, "command-test");
+    item.resize(40, 40);
+
+    QSignalSpy spy(&m_receiver, &CommandReceiver::called);
+    int clicks = 0;
+
+    QBENCHMARK {
+        QTest::mouseClick(&item, Qt::LeftButton, Qt::NoModifier, item.rect().center());
+        ++clicks;
+        QVERIFY(spy.wait(1000));
+    }
+
+    QCOMPARE(spy.count(), clicks);
+    QCOMPARE(m_receiver.lastArgument(), QString("power"));
+
+    // a valid descriptor replaces the command string completely
+    QCOMPARE(plugin.commandCalls(), structured ? 0 : clicks);
+}
+
+QTEST_MAIN(PluginCommandTest)
+
+#include "plugincommandtest.moc"
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "item/pluginsitem.h"
+#include "pluginsiteminterface.h"
+
+#include <QtTest>
+#include <QWidget>
+#include <QPainter>
+
+///
+/// \brief The IconWidget class paints like a typical plugin widget, one
+/// icon sized pixmap.
+///
+class IconWidget : public QWidget
+{
+public:
+    explicit IconWidget(QWidget *parent = nullptr) : QWidget(parent), m_icon(32, 32)
+    {
+        m_icon.fill(Qt::darkCyan);
+        setFixedSize(48, 48);
+    }
+
+protected:
+    void paintEvent(QPaintEvent *e) override
+    {
+        Q_UNUSED(e);
+
+        QPainter painter(this);
+        painter.drawPixmap(rect().center() - m_icon.rect().center(), m_icon);
+    }
+
+private:
+    QPixmap m_icon;
+};
+
+class PaintPlugin : public QObject, public PluginsItemInterface
+{
+    Q_OBJECT
+
+public:
+    explicit PaintPlugin() : m_widget(new IconWidget) {}
+    ~PaintPlugin() { delete m_widget; }
+
+    const QString pluginName() const override { return "paint"; }
+    void init(PluginProxyInterface *proxyInter) override { m_proxyInter = proxyInter; }
+    QWidget *itemWidget(const QString &itemKey) override { Q_UNUSED(itemKey); return m_widget; }
+
+private:
+    // the item takes ownership, it may be gone before the plugin
+    QPointer<QWidget> m_widget;
+};
+
+///
+/// \brief The HoverPlugin class asks for the hover effect on every item but
+/// "declined".
+///
+class HoverPlugin : public PaintPlugin
+{
+    Q_OBJECT
+
+public:
+    Q_INVOKABLE bool itemHoverEffect(const QString &itemKey) { return itemKey != "declined"; }
+};
+
+///
+/// \brief The PluginsItemPaintTest class measures a plugin item repaint with
+/// and without the hover highlight effect.
+///
+class PluginsItemPaintTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void hoverEffect_data();
+    void hoverEffect();
+    void paint_data();
+    void paint();
+};
+
+void PluginsItemPaintTest::hoverEffect_data()
+{
+    QTest::addColumn<bool>("optIn");
+    QTest::addColumn<QString>("key");
+    QTest::addColumn<bool>("effect");
+
+    QTest::newRow("no invokable") << false << "item" << false;
+    QTest::newRow("asked for") << true << "item" << true;
+    QTest::newRow("declined") << true << "declined" << false;
+}
+
+void PluginsItemPaintTest::hoverEffect()
+{
+    QFETCH(bool, optIn);
+    QFETCH(QString, key);
+    QFETCH(bool, effect);
+
+    QScopedPointer<PaintPlugin> plugin(optIn ? new HoverPlugin : new PaintPlugin);
+    PluginsItem item(plugin.data(), key);
+
+    QCOMPARE(item.graphicsEffect() != nullptr, effect);
+}
+
+void PluginsItemPaintTest::paint_data()
+{
+    QTest::addColumn<bool>("optIn");
+    QTest::addColumn<bool>("hover");
+
+    QTest::newRow("plain") << false << false;
+    QTest::newRow("plain, hovered") << false << true;
+    QTest::newRow("hover effect") << true << false;
+    QTest::newRow("hover effect, hovered") << true << true;
+}
+
+void PluginsItemPaintTest::paint()
+{
+    QFETCH(bool, optIn);
+    QFETCH(bool, hover);
+
+    QWidget window;
+    window.resize(60, 60);
+
+    QScopedPointer<PaintPlugin> plugin(optIn ? new HoverPlugin : new PaintPlugin);
+    PluginsItem *item = new PluginsItem(plugin.data(), "item", &window);
+    item->setGeometry(6, 6, 48, 48);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+    if (hover)
+    {
+        QEvent enter(QEvent::Enter);
+        QApplication::sendEvent(item, &enter);
+    }
+
+    QBENCHMARK {
+        item->repaint();
+    }
+
+    QEvent leave(QEvent::Leave);
+    QApplication::sendEvent(item, &leave);
+}
+
+QTEST_MAIN(PluginsItemPaintTest)
+
+#include "pluginsitempainttest.moc"
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "item/components/popupanchor.h"
+
+#include <QtTest>
+#include <QWidget>
+
+///
+/// \brief The PopupAnchorTest class checks which events of the item chain
+/// ask the popup to reposition, paints must never do it.
+///
+class PopupAnchorTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void repaint();
+    void coalesce_data();
+    void coalesce();
+    void reparent();
+    void release();
+
+private:
+    QWidget *m_window = nullptr;
+    QWidget *m_panel = nullptr;
+    QWidget *m_item = nullptr;
+    PopupAnchor *m_anchor = nullptr;
+};
+
+void PopupAnchorTest::init()
+{
+    m_window = new QWidget;
+    m_window->resize(800, 60);
+    m_panel = new QWidget(m_window);
+    m_panel->setGeometry(0, 0, 800, 60);
+    m_item = new QWidget(m_panel);
+    m_item->setGeometry(100, 5, 50, 50);
+    m_window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_window));
+
+    m_anchor = new PopupAnchor(m_item);
+    m_anchor->track(QPoint(125, 0), Dock::Bottom);
+}
+
+void PopupAnchorTest::cleanup()
+{
+    delete m_window;
+    m_window = nullptr;
+}
+
+void PopupAnchorTest::repaint()
+{
+    QSignalSpy spy(m_anchor, &PopupAnchor::geometryChanged);
+
+    for (int i(0); i != 1000; ++i)
+    {
+        m_item->repaint();
+        m_panel->repaint();
+        QCoreApplication::processEvents();
+    }
+
+    QCOMPARE(spy.count(), 0);
+}
+
+void PopupAnchorTest::coalesce_data()
+{
+    QTest::addColumn<int>("level");
+
+    QTest::newRow("item") << 0;
+    QTest::newRow("panel") << 1;
+    QTest::newRow("window") << 2;
+}
+
+void PopupAnchorTest::coalesce()
+{
+    QFETCH(int, level);
+
+    QWidget *w = level == 0 ? m_item : level == 1 ? m_panel : m_window;
+    QSignalSpy spy(m_anchor, &PopupAnchor::geometryChanged);
+
+    // an animation step moves and resizes many times before the loop runs
+    for (int i(0); i != 50; ++i)
+    {
+        w->move(w->pos() + QPoint(1, 0));
+        w->resize(w->size() + QSize(1, 0));
+    }
+
+    QTRY_COMPARE(spy.count(), 1);
+    QTest::qWait(50);
+    QCOMPARE(spy.count(), 1);
+}
+
+void PopupAnchorTest::reparent()
+{
+    QWidget *container = new QWidget(m_window);
+    container->setGeometry(400, 0, 200, 60);
+    container->show();
+
+    QSignalSpy spy(m_anchor, &PopupAnchor::geometryChanged);
+
+    // ParentChange falls through to a reposition
+    m_item->setParent(container);
+    QTRY_COMPARE(spy.count(), 1);
+
+    // the new ancestor is watched, the old one is not
+    m_panel->move(10, 0);
+    QTest::qWait(50);
+    QCOMPARE(spy.count(), 1);
+
+    container->move(410, 0);
+    QTRY_COMPARE(spy.count(), 2);
+}
+
+void PopupAnchorTest::release()
+{
+    QSignalSpy spy(m_anchor, &PopupAnchor::geometryChanged);
+
+    m_anchor->release();
+    m_item->move(0, 0);
+    m_window->resize(600, 60);
+    QTest::qWait(50);
+
+    QCOMPARE(spy.count(), 0);
+}
+
+QTEST_MAIN(PopupAnchorTest)
+
+#include "popupanchortest.moc"
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "util/screentopology.h"
+
+#include <QtTest>
+
+typedef QVector<ScreenTopology::Screen> Screens;
+
+Q_DECLARE_METATYPE(Screens)
+
+///
+/// \brief The ScreenTopologyTest class checks the coordinate mapping on
+/// synthetic multi-monitor and mixed-scale layouts, no real screens needed.
+///
+class ScreenTopologyTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void rawXPosition_data();
+    void rawXPosition();
+    void scaledPos_data();
+    void scaledPos();
+    void roundTrip_data();
+    void roundTrip();
+
+private:
+    static const ScreenTopology::Screen screen(const QRect &logical, const qreal ratio);
+    static const Screens mixedHorizontal();
+    static const Screens mixedVertical();
+};
+
+// same native rect as ScreenTopology::refresh builds
+const ScreenTopology::Screen ScreenTopologyTest::screen(const QRect &logical, const qreal ratio)
+{
+    ScreenTopology::Screen s;
+    s.logical = logical;
+    s.ratio = ratio;
+    s.native = QRect(logical.topLeft(), logical.size() * ratio);
+
+    return s;
+}
+
+// 1x 1920x1080 on the left, 2x 2560x1440 on the right
+const Screens ScreenTopologyTest::mixedHorizontal()
+{
+    return Screens() << screen(QRect(0, 0, 1920, 1080), 1)
+                     << screen(QRect(1920, 0, 1280, 720), 2);
+}
+
+// 1x 1920x1080 on top, 1.5x 1920x1080 below
+const Screens ScreenTopologyTest::mixedVertical()
+{
+    return Screens() << screen(QRect(0, 0, 1920, 1080), 1)
+                     << screen(QRect(0, 1080, 1280, 720), 1.5);
+}
+
+void ScreenTopologyTest::rawXPosition_data()
+{
+    QTest::addColumn<Screens>("screens");
+    QTest::addColumn<int>("primary");
+    QTest::addColumn<QPoint>("scaled");
+    QTest::addColumn<QPoint>("raw");
+
+    QTest::newRow("no screens") << Screens() << 0 << QPoint(10, 10) << QPoint(10, 10);
+    QTest::newRow("single 1x") << (Screens() << screen(QRect(0, 0, 1920, 1080), 1)) << 0 << QPoint(100, 50) << QPoint(100, 50);
+    QTest::newRow("single 2x") << (Screens() << screen(QRect(0, 0, 1280, 720), 2)) << 0 << QPoint(100, 50) << QPoint(200, 100);
+    QTest::newRow("single 2x corner") << (Screens() << screen(QRect(0, 0, 1280, 720), 2)) << 0 << QPoint(1279, 719) << QPoint(2558, 1438);
+    QTest::newRow("single 1.25x") << (Screens() << screen(QRect(0, 0, 1536, 864), 1.25)) << 0 << QPoint(100, 100) << QPoint(125, 125);
+    QTest::newRow("dual 1x right") << (Screens() << screen(QRect(0, 0, 1920, 1080), 1) << screen(QRect(1920, 0, 1920, 1080), 1))
+                                   << 0 << QPoint(2000, 10) << QPoint(2000, 10);
+    QTest::newRow("mixed left") << mixedHorizontal() << 0 << QPoint(100, 50) << QPoint(100, 50);
+    QTest::newRow("mixed right") << mixedHorizontal() << 0 << QPoint(2020, 50) << QPoint(2120, 100);
+    QTest::newRow("mixed right origin") << mixedHorizontal() << 0 << QPoint(1920, 0) << QPoint(1920, 0);
+    QTest::newRow("mixed right primary") << mixedHorizontal() << 1 << QPoint(2020, 50) << QPoint(2120, 100);
+    QTest::newRow("mixed below") << mixedVertical() << 0 << QPoint(100, 1180) << QPoint(150, 1230);
+    // off every screen the primary screen maps it
+    QTest::newRow("outside, primary 1x") << mixedHorizontal() << 0 << QPoint(-100, -100) << QPoint(-100, -100);
+    QTest::newRow("outside, primary 2x") << mixedHorizontal() << 1 << QPoint(-100, -100) << QPoint(-2120, -200);
+    QTest::newRow("primary out of range") << mixedHorizontal() << 5 << QPoint(-100, -100) << QPoint(-2120, -200);
+}
+
+void ScreenTopologyTest::rawXPosition()
+{
+    QFETCH(Screens, screens);
+    QFETCH(int, primary);
+    QFETCH(QPoint, scaled);
+    QFETCH(QPoint, raw);
+
+    QCOMPARE(ScreenTopology::rawXPosition(screens, primary, scaled), raw);
+}
+
+void ScreenTopologyTest::scaledPos_data()
+{
+    QTest::addColumn<Screens>("screens");
+    QTest::addColumn<int>("primary");
+    QTest::addColumn<QPoint>("raw");
+    QTest::addColumn<QPoint>("scaled");
+
+    QTest::newRow("no screens") << Screens() << 0 << QPoint(10, 10) << QPoint(10, 10);
+    QTest::newRow("single 2x") << (Screens() << screen(QRect(0, 0, 1280, 720), 2)) << 0 << QPoint(200, 100) << QPoint(100, 50);
+    QTest::newRow("single 1.25x") << (Screens() << screen(QRect(0, 0, 1536, 864), 1.25)) << 0 << QPoint(125, 125) << QPoint(100, 100);
+    QTest::newRow("mixed left") << mixedHorizontal() << 0 << QPoint(100, 50) << QPoint(100, 50);
+    QTest::newRow("mixed right") << mixedHorizontal() << 0 << QPoint(2120, 100) << QPoint(2020, 50);
+    // the native rect of the 2x screen reaches x = 4480, past its logical right edge
+    QTest::newRow("mixed right, past logical edge") << mixedHorizontal() << 0 << QPoint(4000, 100) << QPoint(2960, 50);
+    QTest::newRow("mixed below") << mixedVertical() << 0 << QPoint(150, 1230) << QPoint(100, 1180);
+    QTest::newRow("outside, primary 2x") << mixedHorizontal() << 1 << QPoint(-2120, -200) << QPoint(-100, -100);
+}
+
+void ScreenTopologyTest::scaledPos()
+{
+    QFETCH(Screens, screens);
+    QFETCH(int, primary);
+    QFETCH(QPoint, raw);
+    QFETCH(QPoint, scaled);
+
+    QCOMPARE(ScreenTopology::scaledPos(screens, primary, raw), scaled);
+}
+
+void ScreenTopologyTest::roundTrip_data()
+{
+    QTest::addColumn<Screens>("screens");
+
+    QTest::newRow("single 2x") << (Screens() << screen(QRect(0, 0, 1280, 720), 2));
+    QTest::newRow("single 1.25x") << (Screens() << screen(QRect(0, 0, 1536, 864), 1.25));
+    QTest::newRow("mixed horizontal") << mixedHorizontal();
+    QTest::newRow("mixed vertical") << mixedVertical();
+}
+
+void ScreenTopologyTest::roundTrip()
+{
+    QFETCH(Screens, screens);
+
+    // every corner and the center of every screen, on both primaries
+    for (int primary(0); primary != screens.size(); ++primary)
+    {
+        for (const auto &s : screens)
+        {
+            const QRect &r = s.logical;
+            for (const QPoint &p : { r.topLeft(), r.topRight(), r.bottomLeft(), r.bottomRight(), r.center() })
+            {
+                const QPoint raw = ScreenTopology::rawXPosition(screens, primary, p);
+                const QPoint back = ScreenTopology::scaledPos(screens, primary, raw);
+
+                // fractional scales may round by one pixel
+                QVERIFY2((back - p).manhattanLength() <= 1,
+                         qPrintable(QString("%1,%2 -> %3,%4 -> %5,%6").arg(p.x()).arg(p.y()).arg(raw.x()).arg(raw.y()).arg(back.x()).arg(back.y())));
+            }
+        }
+    }
+}
+
+QTEST_GUILESS_MAIN(ScreenTopologyTest)
+
+#include "screentopologytest.moc"
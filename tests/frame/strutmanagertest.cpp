@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "window/strutmanager.h"
+#include "window/mainwindow.h"
+
+#include <QtTest>
+#include <QWidget>
+#include <QX11Info>
+#include <QProcess>
+#include <QDBusConnection>
+#include <QDBusConnectionInterface>
+#include <QDBusMessage>
+#include <QDBusVariant>
+#include <QGSettings>
+
+#include <xcb/xcb.h>
+
+#define MOCK_SERVICE    "com.deepin.dde.DockMock"
+
+// xcb_ewmh_wm_strut_partial_t layout
+enum StrutIndex
+{
+    StrutLeft, StrutRight, StrutTop, StrutBottom,
+    LeftStartY, LeftEndY, RightStartY, RightEndY,
+    TopStartX, TopEndX, BottomStartX, BottomEndX,
+    StrutSize
+};
+
+Q_DECLARE_METATYPE(XcbMisc::Orientation)
+
+///
+/// \brief The StrutManagerTest class writes struts on a window of the test X
+/// server and reads _NET_WM_STRUT_PARTIAL back to count the real writes.
+///
+class StrutManagerTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void init();
+    void cleanup();
+
+    void coalesce_data();
+    void coalesce();
+    void clear();
+    void invalidate();
+    void mainWindowPosition();
+
+private:
+    const QVector<uint> readStrut(const WId window) const;
+
+private:
+    xcb_atom_t m_strutAtom = XCB_ATOM_NONE;
+    QWidget *m_window = nullptr;
+    StrutManager *m_manager = nullptr;
+};
+
+void StrutManagerTest::initTestCase()
+{
+    if (!QX11Info::isPlatformX11())
+        QSKIP("needs an X server");
+
+    xcb_connection_t *c = QX11Info::connection();
+    const char name[] = "_NET_WM_STRUT_PARTIAL";
+    xcb_intern_atom_reply_t *reply = xcb_intern_atom_reply(c, xcb_intern_atom(c, false, sizeof(name) - 1, name), nullptr);
+    QVERIFY(reply);
+    m_strutAtom = reply->atom;
+    free(reply);
+}
+
+void StrutManagerTest::init()
+{
+    m_window = new QWidget;
+    m_window->resize(800, 40);
+    m_window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_window));
+
+    m_manager = new StrutManager(m_window);
+}
+
+void StrutManagerTest::cleanup()
+{
+    delete m_window;
+    m_window = nullptr;
+    m_manager = nullptr;
+}
+
+void StrutManagerTest::coalesce_data()
+{
+    QTest::addColumn<XcbMisc::Orientation>("orientation");
+    QTest::addColumn<int>("strutIndex");
+    QTest::addColumn<int>("startIndex");
+
+    QTest::newRow("top") << XcbMisc::OrientationTop << int(StrutTop) << int(TopStartX);
+    QTest::newRow("bottom") << XcbMisc::OrientationBottom << int(StrutBottom) << int(BottomStartX);
+    QTest::newRow("left") << XcbMisc::OrientationLeft << int(StrutLeft) << int(LeftStartY);
+    QTest::newRow("right") << XcbMisc::OrientationRight << int(StrutRight) << int(RightStartY);
+}
+
+void StrutManagerTest::coalesce()
+{
+    QFETCH(XcbMisc::Orientation, orientation);
+    QFETCH(int, strutIndex);
+    QFETCH(int, startIndex);
+
+    // a show animation declares a new strut every frame, all in one iteration here
+    StrutManager::Strut strut;
+    strut.orientation = orientation;
+    strut.start = 10;
+    strut.end = 790;
+    for (uint i(1); i <= 40; ++i)
+    {
+        strut.strut = i;
+        m_manager->setStrut(strut);
+    }
+
+    QTRY_COMPARE(m_manager->writeCount(), 1);
+
+    QVector<uint> expected(StrutSize, 0);
+    expected[strutIndex] = 40;
+    expected[startIndex] = 10;
+    expected[startIndex + 1] = 790;
+    QCOMPARE(readStrut(m_window->winId()), expected);
+
+    // declaring the same strut again is not a write
+    for (int i(0); i != 40; ++i)
+    {
+        m_manager->setStrut(strut);
+        QCoreApplication::processEvents();
+    }
+    QCOMPARE(m_manager->writeCount(), 1);
+}
+
+void StrutManagerTest::clear()
+{
+    StrutManager::Strut strut;
+    strut.strut = 40;
+    strut.end = 800;
+    m_manager->setStrut(strut);
+    QTRY_COMPARE(m_manager->writeCount(), 1);
+
+    m_manager->clear();
+    m_manager->clear();
+    QTRY_COMPARE(m_manager->writeCount(), 2);
+    QCOMPARE(readStrut(m_window->winId()), QVector<uint>(StrutSize, 0));
+
+    // all empty struts are the same value, whatever else they carry
+    StrutManager::Strut empty;
+    empty.orientation = XcbMisc::OrientationLeft;
+    empty.end = 600;
+    m_manager->setStrut(empty);
+    QTest::qWait(50);
+    QCOMPARE(m_manager->writeCount(), 2);
+}
+
+void StrutManagerTest::invalidate()
+{
+    StrutManager::Strut strut;
+    strut.orientation = XcbMisc::OrientationBottom;
+    strut.strut = 40;
+    strut.end = 800;
+    m_manager->setStrut(strut);
+    QTRY_COMPARE(m_manager->writeCount(), 1);
+    const QVector<uint> written = readStrut(m_window->winId());
+
+    // a new window manager starts from scratch, the property must be written again
+    xcb_delete_property(QX11Info::connection(), m_window->winId(), m_strutAtom);
+    QVERIFY(readStrut(m_window->winId()).isEmpty());
+
+    m_manager->invalidate();
+    QTRY_COMPARE(m_manager->writeCount(), 2);
+    QCOMPARE(readStrut(m_window->winId()), written);
+}
+
+///
+/// \brief StrutManagerTest::mainWindowPosition move the dock around the
+/// screen through the daemon, the strut must follow every position and stay
+/// put once the animations are done.
+///
+void StrutManagerTest::mainWindowPosition()
+{
+    if (!QGSettings::isSchemaInstalled("com.deepin.dde.dock"))
+        QSKIP("the com.deepin.dde.dock schema is not installed");
+
+    QProcess daemon;
+    daemon.start(MOCK_DAEMON_PATH, QStringList());
+    QVERIFY(daemon.waitForStarted());
+    QTRY_VERIFY(QDBusConnection::sessionBus().interface()->isServiceRegistered(MOCK_SERVICE));
+
+    MainWindow window;
+    window.launch();
+
+    StrutManager *manager = window.findChild<StrutManager *>();
+    QVERIFY(manager);
+
+    struct Step
+    {
+        Dock::Position position;
+        int strutIndex;
+        int startIndex;
+    };
+
+    // the daemon starts at the bottom
+    const QList<Step> steps = { { Dock::Bottom, int(StrutBottom), int(BottomStartX) },
+                                { Dock::Top, int(StrutTop), int(TopStartX) },
+                                { Dock::Right, int(StrutRight), int(RightStartY) },
+                                { Dock::Left, int(StrutLeft), int(LeftStartY) },
+                                { Dock::Bottom, int(StrutBottom), int(BottomStartX) } };
+
+    for (int i(0); i != steps.size(); ++i)
+    {
+        const Step &step = steps[i];
+
+        if (i)
+        {
+            QDBusMessage set = QDBusMessage::createMethodCall("com.deepin.dde.daemon.Dock", "/com/deepin/dde/daemon/Dock",
+                                                              "org.freedesktop.DBus.Properties", "Set");
+            set << "com.deepin.dde.daemon.Dock" << "Position" << QVariant::fromValue(QDBusVariant(int(step.position)));
+            QDBusConnection::sessionBus().call(set);
+        }
+
+        const bool horizontal = step.position == Dock::Top || step.position == Dock::Bottom;
+        QTRY_COMPARE_WITH_TIMEOUT(readStrut(window.winId()).value(step.strutIndex), uint(horizontal ? window.height() : window.width()), 5000);
+
+        QVector<uint> strut = readStrut(window.winId());
+        QVERIFY(strut.value(step.startIndex) < strut.value(step.startIndex + 1));
+
+        // only the dock side is reserved
+        strut[step.strutIndex] = 0;
+        strut[step.startIndex] = 0;
+        strut[step.startIndex + 1] = 0;
+        QCOMPARE(strut, QVector<uint>(StrutSize, 0));
+
+        // the clear and set around the animation are the last writes
+        const int writes = manager->writeCount();
+        QTest::qWait(800);
+        QCOMPARE(manager->writeCount(), writes);
+    }
+
+    daemon.kill();
+    daemon.waitForFinished();
+}
+
+const QVector<uint> StrutManagerTest::readStrut(const WId window) const
+{
+    xcb_connection_t *c = QX11Info::connection();
+    const xcb_get_property_cookie_t cookie = xcb_get_property(c, false, window, m_strutAtom, XCB_ATOM_CARDINAL, 0, StrutSize);
+    xcb_get_property_reply_t *reply = xcb_get_property_reply(c, cookie, nullptr);
+
+    QVector<uint> values;
+    if (reply && reply->format == 32)
+    {
+        const uint32_t *data = static_cast<const uint32_t *>(xcb_get_property_value(reply));
+        for (int i(0); i != xcb_get_property_value_length(reply) / 4; ++i)
+            values << data[i];
+    }
+    free(reply);
+
+    return values;
+}
+
+QTEST_MAIN(StrutManagerTest)
+
+#include "strutmanagertest.moc"
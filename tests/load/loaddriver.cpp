@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "loaddriver.h"
+
+#include <QDBusConnection>
+#include <QDBusConnectionInterface>
+#include <QDBusReply>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QTimer>
+#include <QThread>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+
+#include <unistd.h>
+
+#define DOCK_SERVICE    "com.deepin.dde.Dock"
+#define MOCK_SERVICE    "com.deepin.dde.DockMock"
+#define MOCK_PATH       "/com/deepin/dde/DockMock"
+#define MOCK_INTERFACE  "com.deepin.dde.DockMock"
+
+// time the dock gets to drain queued work after the last scenario event
+#define SETTLE_INTERVAL 500
+
+///
+/// \brief histogramDelta subtract the \a before bucket counts from \a after,
+/// max_us can not be subtracted and stays the maximum since tracing started.
+///
+static QJsonObject histogramDelta(const QJsonObject &before, const QJsonObject &after)
+{
+    const QJsonArray beforeBuckets = before["buckets"].toArray();
+    QJsonArray buckets = after["buckets"].toArray();
+    for (int i(0); i != buckets.size() && i != beforeBuckets.size(); ++i)
+    {
+        QJsonObject bucket = buckets[i].toObject();
+        bucket["count"] = bucket["count"].toInt() - beforeBuckets[i].toObject()["count"].toInt();
+        buckets[i] = bucket;
+    }
+
+    QJsonObject delta;
+    delta["count"] = after["count"].toDouble() - before["count"].toDouble();
+    delta["max_us"] = after["max_us"];
+    delta["buckets"] = buckets;
+
+    return delta;
+}
+
+LoadDriver::LoadDriver(QObject *parent)
+    : QObject(parent),
+
+      m_dockPid(0),
+      m_finishedEvents(0)
+{
+    QDBusConnection::sessionBus().connect(MOCK_SERVICE, MOCK_PATH, MOCK_INTERFACE, "ScenarioFinished",
+                                          this, SLOT(onScenarioFinished(QString,int)));
+}
+
+///
+/// \brief LoadDriver::attach wait up to \a timeout ms for the mock daemon and
+/// the dock, then turn on the dock event loop tracer.
+///
+bool LoadDriver::attach(const int timeout)
+{
+    if (!waitForService(MOCK_SERVICE, timeout) || !waitForService(DOCK_SERVICE, timeout))
+        return false;
+
+    const QDBusReply<uint> pid = QDBusConnection::sessionBus().interface()->servicePid(DOCK_SERVICE);
+    if (!pid.isValid())
+        return false;
+
+    m_dockPid = pid.value();
+
+    return callDock("SetTracingEnabled", QVariantList() << true).type() == QDBusMessage::ReplyMessage;
+}
+
+const QStringList LoadDriver::scenarios()
+{
+    const QDBusMessage reply = callMock("ListScenarios");
+    if (reply.type() != QDBusMessage::ReplyMessage || reply.arguments().isEmpty())
+        return QStringList();
+
+    return reply.arguments().first().toStringList();
+}
+
+///
+/// \brief LoadDriver::run replay \a count events of \a scenario, one every
+/// \a interval ms, and report the dock cost of the whole run.
+///
+const QJsonObject LoadDriver::run(const QString &scenario, const int count, const int interval)
+{
+    QJsonObject result;
+    result["scenario"] = scenario;
+
+    const ProcessSample before = sample();
+    const QJsonObject summaryBefore = traceSummary();
+
+    m_finishedScenario.clear();
+    m_finishedEvents = 0;
+
+    QElapsedTimer wall;
+    wall.start();
+
+    const QDBusMessage reply = callMock("RunScenario", QVariantList() << scenario << count << interval);
+    if (reply.type() != QDBusMessage::ReplyMessage || !reply.arguments().value(0).toBool())
+    {
+        result["error"] = "scenario rejected by the mock daemon";
+        return result;
+    }
+
+    QEventLoop loop;
+    QTimer timeout;
+    timeout.setSingleShot(true);
+    timeout.setInterval(count * interval + 10000);
+    connect(&timeout, &QTimer::timeout, &loop, &QEventLoop::quit);
+    connect(this, &LoadDriver::scenarioFinished, &loop, &QEventLoop::quit);
+    timeout.start();
+    if (m_finishedScenario != scenario)
+        loop.exec();
+
+    if (m_finishedScenario != scenario)
+    {
+        callMock("Stop");
+        result["error"] = "scenario timed out";
+        return result;
+    }
+
+    QTimer::singleShot(SETTLE_INTERVAL, &loop, &QEventLoop::quit);
+    loop.exec();
+
+    const ProcessSample after = sample();
+    const QJsonObject summaryAfter = traceSummary();
+
+    result["events"] = m_finishedEvents;
+    result["interval_ms"] = interval;
+    result["wall_ms"] = wall.elapsed();
+    result["cpu_ms"] = after.cpuMs - before.cpuMs;
+    result["wakeups"] = after.voluntarySwitches - before.voluntarySwitches;
+    result["preemptions"] = after.involuntarySwitches - before.involuntarySwitches;
+    result["loop_iterations"] = histogramDelta(summaryBefore["iteration_busy"].toObject(),
+                                               summaryAfter["iteration_busy"].toObject());
+    result["loop_latency"] = histogramDelta(summaryBefore["timer_lag"].toObject(),
+                                            summaryAfter["timer_lag"].toObject());
+
+    return result;
+}
+
+///
+/// \brief LoadDriver::sample read utime + stime from /proc/<pid>/stat and the
+/// context switch counters from /proc/<pid>/status, a voluntary switch is
+/// the dock going to sleep, so it counts its wakeups.
+///
+const LoadDriver::ProcessSample LoadDriver::sample() const
+{
+    ProcessSample s;
+
+    QFile stat(QString("/proc/%1/stat").arg(m_dockPid));
+    if (stat.open(QIODevice::ReadOnly))
+    {
+        // the command name may hold spaces, fields are counted after its ')'
+        const QByteArray data = stat.readAll();
+        const QList<QByteArray> fields = data.mid(data.lastIndexOf(')') + 2).split(' ');
+        if (fields.size() > 12)
+        {
+            const qint64 ticks = fields[11].toLongLong() + fields[12].toLongLong();
+            s.cpuMs = ticks * 1000 / sysconf(_SC_CLK_TCK);
+        }
+    }
+
+    QFile status(QString("/proc/%1/status").arg(m_dockPid));
+    if (status.open(QIODevice::ReadOnly))
+    {
+        for (const QByteArray &line : status.readAll().split('\n'))
+        {
+            if (line.startsWith("voluntary_ctxt_switches:"))
+                s.voluntarySwitches = line.mid(line.indexOf(':') + 1).trimmed().toLongLong();
+            else if (line.startsWith("nonvoluntary_ctxt_switches:"))
+                s.involuntarySwitches = line.mid(line.indexOf(':') + 1).trimmed().toLongLong();
+        }
+    }
+
+    return s;
+}
+
+const QJsonObject LoadDriver::traceSummary()
+{
+    const QDBusMessage reply = callDock("TraceSummary");
+    if (reply.type() != QDBusMessage::ReplyMessage || reply.arguments().isEmpty())
+        return QJsonObject();
+
+    return QJsonDocument::fromJson(reply.arguments().first().toString().toUtf8()).object();
+}
+
+bool LoadDriver::waitForService(const QString &service, const int timeout) const
+{
+    QDBusConnectionInterface *bus = QDBusConnection::sessionBus().interface();
+
+    QElapsedTimer timer;
+    timer.start();
+    while (!bus->isServiceRegistered(service))
+    {
+        if (timer.elapsed() > timeout)
+            return false;
+
+        QThread::msleep(50);
+    }
+
+    return true;
+}
+
+const QDBusMessage LoadDriver::callDock(const QString &method, const QVariantList &args) const
+{
+    QDBusMessage msg = QDBusMessage::createMethodCall(DOCK_SERVICE, "/com/deepin/dde/Dock", "com.deepin.dde.Dock", method);
+    msg.setArguments(args);
+
+    return QDBusConnection::sessionBus().call(msg);
+}
+
+const QDBusMessage LoadDriver::callMock(const QString &method, const QVariantList &args) const
+{
+    QDBusMessage msg = QDBusMessage::createMethodCall(MOCK_SERVICE, MOCK_PATH, MOCK_INTERFACE, method);
+    msg.setArguments(args);
+
+    return QDBusConnection::sessionBus().call(msg);
+}
+
+void LoadDriver::onScenarioFinished(const QString &name, int events)
+{
+    m_finishedScenario = name;
+    m_finishedEvents = events;
+
+    emit scenarioFinished();
+}
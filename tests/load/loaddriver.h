@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOADDRIVER_H
+#define LOADDRIVER_H
+
+#include <QObject>
+#include <QJsonObject>
+#include <QDBusMessage>
+
+///
+/// \brief The LoadDriver class replays mock daemon scenarios against a
+/// running dock and measures what each one costs the dock process: cpu
+/// time and context switches from /proc, main loop iterations and timer
+/// lag from the dock event loop tracer.
+///
+class LoadDriver : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit LoadDriver(QObject *parent = nullptr);
+
+    bool attach(const int timeout);
+    const QStringList scenarios();
+    const QJsonObject run(const QString &scenario, const int count, const int interval);
+
+signals:
+    void scenarioFinished() const;
+
+private:
+    struct ProcessSample
+    {
+        qint64 cpuMs = 0;
+        qint64 voluntarySwitches = 0;
+        qint64 involuntarySwitches = 0;
+    };
+
+    const ProcessSample sample() const;
+    const QJsonObject traceSummary();
+    bool waitForService(const QString &service, const int timeout) const;
+    const QDBusMessage callDock(const QString &method, const QVariantList &args = QVariantList()) const;
+    const QDBusMessage callMock(const QString &method, const QVariantList &args = QVariantList()) const;
+
+private slots:
+    void onScenarioFinished(const QString &name, int events);
+
+private:
+    uint m_dockPid;
+    QString m_finishedScenario;
+    int m_finishedEvents;
+};
+
+#endif // LOADDRIVER_H
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "loaddriver.h"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QFile>
+#include <QDebug>
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName("dde-dock-load-driver");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Replay mock daemon scenarios against a running dde-dock.");
+    parser.addHelpOption();
+    parser.addOption({"count", "Events per scenario.", "count", "200"});
+    parser.addOption({"interval", "Milliseconds between two events.", "ms", "5"});
+    parser.addOption({"timeout", "Milliseconds to wait for the dock and the mock daemon.", "ms", "30000"});
+    parser.addOption({"output", "Write the report to this file instead of stdout.", "file"});
+    parser.addPositionalArgument("scenario", "Scenarios to run, all of them when omitted.", "[scenario...]");
+    parser.process(app);
+
+    LoadDriver driver;
+    if (!driver.attach(parser.value("timeout").toInt()))
+    {
+        qWarning() << "dde-dock or the mock daemon is not on this session bus";
+        return -1;
+    }
+
+    QStringList scenarios = parser.positionalArguments();
+    if (scenarios.isEmpty())
+        scenarios = driver.scenarios();
+
+    bool failed = false;
+    QJsonArray report;
+    for (const QString &scenario : scenarios)
+    {
+        const QJsonObject result = driver.run(scenario, parser.value("count").toInt(), parser.value("interval").toInt());
+        failed |= result.contains("error");
+        report << result;
+    }
+
+    const QByteArray json = QJsonDocument(report).toJson();
+    if (parser.isSet("output"))
+    {
+        QFile f(parser.value("output"));
+        if (!f.open(QIODevice::WriteOnly | QIODevice::Truncate))
+            return -1;
+        f.write(json);
+    } else {
+        QFile out;
+        out.open(stdout, QIODevice::WriteOnly);
+        out.write(json);
+    }
+
+    return failed ? -1 : 0;
+}
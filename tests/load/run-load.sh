@@ -0,0 +1,30 @@
+#!/bin/sh
+#
+# run-load.sh <build dir> [driver options] [scenario...]
+#
+# the build dir must be configured with -DBUILD_TESTING=ON.
+#
+# starts the mock daemon, dde-dock and the load driver on a private session
+# bus, under a private X server when no display is available. the report is
+# written to stdout, see dde-dock-load-driver --help for the options.
+
+set -e
+
+BUILD_DIR=${1:?usage: run-load.sh <build dir> [driver options] [scenario...]}
+shift
+
+if [ -z "$DDE_DOCK_LOAD_BUS" ]; then
+    export DDE_DOCK_LOAD_BUS=1
+    if [ -z "$DISPLAY" ]; then
+        exec dbus-run-session -- xvfb-run -a "$0" "$BUILD_DIR" "$@"
+    fi
+    exec dbus-run-session -- "$0" "$BUILD_DIR" "$@"
+fi
+
+"$BUILD_DIR/tests/mock/dde-dock-mock-daemon" &
+MOCK_PID=$!
+"$BUILD_DIR/frame/dde-dock" > /dev/null 2>&1 &
+DOCK_PID=$!
+trap 'kill $DOCK_PID $MOCK_PID 2> /dev/null' EXIT
+
+"$BUILD_DIR/tests/load/dde-dock-load-driver" "$@"
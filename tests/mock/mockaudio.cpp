@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mockaudio.h"
+#include "mocktypes.h"
+
+#include <QDBusConnection>
+
+#define AUDIO_PATH  "/com/deepin/daemon/Audio"
+
+MockSinkAdaptor::MockSinkAdaptor(QObject *parent)
+    : QDBusAbstractAdaptor(parent),
+
+      m_mute(false),
+      m_volume(0.5)
+{
+}
+
+const QString MockSinkAdaptor::sinkPath()
+{
+    return QStringLiteral(AUDIO_PATH "/Sink0");
+}
+
+void MockSinkAdaptor::SetVolume(double volume, bool isPlay)
+{
+    Q_UNUSED(isPlay);
+
+    m_volume = volume;
+
+    QVariantMap changed;
+    changed["Volume"] = m_volume;
+    notifyPropertiesChanged(sinkPath(), "com.deepin.daemon.Audio.Sink", changed);
+}
+
+void MockSinkAdaptor::SetMute(bool mute)
+{
+    m_mute = mute;
+
+    QVariantMap changed;
+    changed["Mute"] = m_mute;
+    notifyPropertiesChanged(sinkPath(), "com.deepin.daemon.Audio.Sink", changed);
+}
+
+QDBusObjectPath MockSinkAdaptor::GetMeter()
+{
+    return QDBusObjectPath("/");
+}
+
+MockSinkInputAdaptor::MockSinkInputAdaptor(const int id, QObject *parent)
+    : QDBusAbstractAdaptor(parent),
+
+      m_path(QString(AUDIO_PATH "/SinkInput%1").arg(id)),
+      m_name(QString("mock-stream-%1").arg(id)),
+      m_mute(false),
+      m_volume(1.0)
+{
+}
+
+void MockSinkInputAdaptor::SetVolume(double volume, bool isPlay)
+{
+    Q_UNUSED(isPlay);
+
+    m_volume = volume;
+
+    QVariantMap changed;
+    changed["Volume"] = m_volume;
+    notifyPropertiesChanged(m_path, "com.deepin.daemon.Audio.SinkInput", changed);
+}
+
+void MockSinkInputAdaptor::SetMute(bool mute)
+{
+    m_mute = mute;
+
+    QVariantMap changed;
+    changed["Mute"] = m_mute;
+    notifyPropertiesChanged(m_path, "com.deepin.daemon.Audio.SinkInput", changed);
+}
+
+MockAudioAdaptor::MockAudioAdaptor(QObject *parent)
+    : QDBusAbstractAdaptor(parent),
+
+      m_nextInputId(0)
+{
+    QObject *sink = new QObject(parent);
+    new MockSinkAdaptor(sink);
+    QDBusConnection::sessionBus().registerObject(MockSinkAdaptor::sinkPath(), sink);
+}
+
+QList<QDBusObjectPath> MockAudioAdaptor::sinkInputs() const
+{
+    QList<QDBusObjectPath> paths;
+    for (auto *input : m_sinkInputs)
+        paths << QDBusObjectPath(input->path());
+
+    return paths;
+}
+
+void MockAudioAdaptor::addSinkInput()
+{
+    QObject *object = new QObject(parent());
+    MockSinkInputAdaptor *input = new MockSinkInputAdaptor(m_nextInputId++, object);
+    QDBusConnection::sessionBus().registerObject(input->path(), object);
+
+    m_sinkInputs.append(input);
+
+    QVariantMap changed;
+    changed["SinkInputs"] = QVariant::fromValue(sinkInputs());
+    notifyPropertiesChanged(AUDIO_PATH, "com.deepin.daemon.Audio", changed);
+}
+
+void MockAudioAdaptor::removeSinkInput()
+{
+    if (m_sinkInputs.isEmpty())
+        return;
+
+    MockSinkInputAdaptor *input = m_sinkInputs.takeFirst();
+    QDBusConnection::sessionBus().unregisterObject(input->path());
+    input->parent()->deleteLater();
+
+    QVariantMap changed;
+    changed["SinkInputs"] = QVariant::fromValue(sinkInputs());
+    notifyPropertiesChanged(AUDIO_PATH, "com.deepin.daemon.Audio", changed);
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MOCKAUDIO_H
+#define MOCKAUDIO_H
+
+#include <QDBusAbstractAdaptor>
+#include <QDBusObjectPath>
+#include <QList>
+
+///
+/// \brief The MockSinkAdaptor class stands in for the default output,
+/// com.deepin.daemon.Audio.Sink.
+///
+class MockSinkAdaptor : public QDBusAbstractAdaptor
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "com.deepin.daemon.Audio.Sink")
+    Q_PROPERTY(QString Name READ name)
+    Q_PROPERTY(QString Description READ name)
+    Q_PROPERTY(double BaseVolume READ baseVolume)
+    Q_PROPERTY(bool Mute READ mute)
+    Q_PROPERTY(double Volume READ volume)
+    Q_PROPERTY(double Balance READ balance)
+    Q_PROPERTY(bool SupportBalance READ support)
+    Q_PROPERTY(double Fade READ balance)
+    Q_PROPERTY(bool SupportFade READ support)
+
+public:
+    explicit MockSinkAdaptor(QObject *parent);
+
+    static const QString sinkPath();
+
+    inline QString name() const { return QStringLiteral("mock-sink"); }
+    inline double baseVolume() const { return 1.0; }
+    inline bool mute() const { return m_mute; }
+    inline double volume() const { return m_volume; }
+    inline double balance() const { return 0.0; }
+    inline bool support() const { return false; }
+
+public slots:
+    void SetVolume(double volume, bool isPlay);
+    void SetMute(bool mute);
+    QDBusObjectPath GetMeter();
+
+private:
+    bool m_mute;
+    double m_volume;
+};
+
+///
+/// \brief The MockSinkInputAdaptor class stands in for one playing stream,
+/// com.deepin.daemon.Audio.SinkInput.
+///
+class MockSinkInputAdaptor : public QDBusAbstractAdaptor
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "com.deepin.daemon.Audio.SinkInput")
+    Q_PROPERTY(QString Name READ name)
+    Q_PROPERTY(QString Icon READ icon)
+    Q_PROPERTY(bool Mute READ mute)
+    Q_PROPERTY(double Volume READ volume)
+    Q_PROPERTY(double Balance READ balance)
+    Q_PROPERTY(bool SupportBalance READ support)
+    Q_PROPERTY(double Fade READ balance)
+    Q_PROPERTY(bool SupportFade READ support)
+
+public:
+    explicit MockSinkInputAdaptor(const int id, QObject *parent);
+
+    inline const QString path() const { return m_path; }
+    inline QString name() const { return m_name; }
+    inline QString icon() const { return QStringLiteral("audio-x-generic"); }
+    inline bool mute() const { return m_mute; }
+    inline double volume() const { return m_volume; }
+    inline double balance() const { return 0.0; }
+    inline bool support() const { return false; }
+
+public slots:
+    void SetVolume(double volume, bool isPlay);
+    void SetMute(bool mute);
+
+private:
+    const QString m_path;
+    const QString m_name;
+    bool m_mute;
+    double m_volume;
+};
+
+///
+/// \brief The MockAudioAdaptor class stands in for com.deepin.daemon.Audio,
+/// the scenarios add and remove its sink inputs.
+///
+class MockAudioAdaptor : public QDBusAbstractAdaptor
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "com.deepin.daemon.Audio")
+    Q_PROPERTY(QString Cards READ cards)
+    Q_PROPERTY(QDBusObjectPath DefaultSink READ defaultSink)
+    Q_PROPERTY(QDBusObjectPath DefaultSource READ defaultSource)
+    Q_PROPERTY(double MaxUIVolume READ maxUIVolume)
+    Q_PROPERTY(QList<QDBusObjectPath> SinkInputs READ sinkInputs)
+
+public:
+    explicit MockAudioAdaptor(QObject *parent);
+
+    inline QString cards() const { return QStringLiteral("[]"); }
+    inline QDBusObjectPath defaultSink() const { return QDBusObjectPath(MockSinkAdaptor::sinkPath()); }
+    inline QDBusObjectPath defaultSource() const { return QDBusObjectPath("/"); }
+    inline double maxUIVolume() const { return 1.0; }
+    QList<QDBusObjectPath> sinkInputs() const;
+
+    inline int sinkInputCount() const { return m_sinkInputs.size(); }
+    void addSinkInput();
+    void removeSinkInput();
+
+private:
+    int m_nextInputId;
+    QList<MockSinkInputAdaptor *> m_sinkInputs;
+};
+
+#endif // MOCKAUDIO_H
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mockcontroladaptor.h"
+#include "mockdaemon.h"
+
+MockControlAdaptor::MockControlAdaptor(MockDaemon *parent)
+    : QDBusAbstractAdaptor(parent)
+{
+    connect(parent, &MockDaemon::scenarioFinished, this, &MockControlAdaptor::ScenarioFinished);
+}
+
+MockDaemon *MockControlAdaptor::parent() const
+{
+    return static_cast<MockDaemon *>(QObject::parent());
+}
+
+QStringList MockControlAdaptor::ListScenarios()
+{
+    return parent()->scenarios();
+}
+
+bool MockControlAdaptor::RunScenario(const QString &name, int count, int intervalMs)
+{
+    return parent()->runScenario(name, count, intervalMs);
+}
+
+void MockControlAdaptor::Stop()
+{
+    parent()->stop();
+}
+
+void MockControlAdaptor::SetEntryCount(int count)
+{
+    parent()->setEntryCount(count);
+}
+
+void MockControlAdaptor::AddEntry(const QString &id, int index)
+{
+    parent()->addEntry(id, index);
+}
+
+void MockControlAdaptor::RemoveEntry(const QString &id)
+{
+    parent()->removeEntry(id);
+}
+
+int MockControlAdaptor::CallCount(const QString &method)
+{
+    return parent()->callCount(method);
+}
+
+void MockControlAdaptor::ResetCallCounts()
+{
+    parent()->resetCallCounts();
+}
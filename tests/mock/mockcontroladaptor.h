@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MOCKCONTROLADAPTOR_H
+#define MOCKCONTROLADAPTOR_H
+
+#include <QDBusAbstractAdaptor>
+#include <QStringList>
+
+class MockDaemon;
+
+///
+/// \brief The MockControlAdaptor class exports com.deepin.dde.DockMock, the
+/// interface load drivers and tests use to script the mock daemon.
+///
+class MockControlAdaptor : public QDBusAbstractAdaptor
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "com.deepin.dde.DockMock")
+
+public:
+    explicit MockControlAdaptor(MockDaemon *parent);
+
+    MockDaemon *parent() const;
+
+public slots:
+    QStringList ListScenarios();
+    bool RunScenario(const QString &name, int count, int intervalMs);
+    void Stop();
+    void SetEntryCount(int count);
+    void AddEntry(const QString &id, int index);
+    void RemoveEntry(const QString &id);
+    int CallCount(const QString &method);
+    void ResetCallCounts();
+
+signals:
+    void ScenarioFinished(const QString &name, int events);
+};
+
+#endif // MOCKCONTROLADAPTOR_H
@@ -0,0 +1,251 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mockdaemon.h"
+#include "mockcontroladaptor.h"
+#include "mockdock.h"
+#include "mockdisplay.h"
+#include "mocknetwork.h"
+#include "mockaudio.h"
+#include "mocktraymanager.h"
+#include "mockdiskmount.h"
+#include "mocktypes.h"
+
+#include <QDBusConnection>
+#include <QTimer>
+
+MockDaemon::MockDaemon(QObject *parent)
+    : QObject(parent),
+
+      m_dock(new MockDockAdaptor(new QObject(this))),
+      m_display(new MockDisplayAdaptor(new QObject(this))),
+      m_network(new MockNetworkAdaptor(new QObject(this))),
+      m_audio(new MockAudioAdaptor(new QObject(this))),
+      m_trayManager(new MockTrayManagerAdaptor(new QObject(this))),
+      m_diskMount(new MockDiskMountAdaptor(new QObject(this))),
+
+      m_stepTimer(new QTimer(this)),
+      m_step(0),
+      m_count(0)
+{
+    registerMockTypes();
+
+    new MockControlAdaptor(this);
+
+    m_scenarios.insert("entry-flood", &MockDaemon::entryFloodStep);
+    m_scenarios.insert("window-info-churn", &MockDaemon::windowInfoChurnStep);
+    m_scenarios.insert("ap-scan-storm", &MockDaemon::apScanStormStep);
+    m_scenarios.insert("sink-input-storm", &MockDaemon::sinkInputStormStep);
+    m_scenarios.insert("tray-flapping", &MockDaemon::trayFlappingStep);
+    m_scenarios.insert("disk-hotplug", &MockDaemon::diskHotplugStep);
+
+    connect(m_stepTimer, &QTimer::timeout, this, &MockDaemon::step);
+}
+
+///
+/// \brief MockDaemon::registerServices export every object first and claim the
+/// names afterwards, com.deepin.dde.DockMock is taken last so a client waiting
+/// for it finds all the other services ready.
+///
+bool MockDaemon::registerServices()
+{
+    QDBusConnection bus = QDBusConnection::sessionBus();
+
+    bool ok = bus.registerObject("/com/deepin/dde/daemon/Dock", m_dock->parent());
+    ok &= bus.registerObject("/com/deepin/daemon/Display", m_display->parent());
+    ok &= bus.registerObject("/com/deepin/daemon/Network", m_network->parent());
+    ok &= bus.registerObject("/com/deepin/daemon/Audio", m_audio->parent());
+    ok &= bus.registerObject("/com/deepin/dde/TrayManager", m_trayManager->parent());
+    ok &= bus.registerObject("/com/deepin/daemon/DiskMount", m_diskMount->parent());
+    ok &= bus.registerObject("/com/deepin/dde/DockMock", this);
+
+    ok &= bus.registerService("com.deepin.dde.daemon.Dock");
+    ok &= bus.registerService("com.deepin.daemon.Display");
+    ok &= bus.registerService("com.deepin.daemon.Network");
+    ok &= bus.registerService("com.deepin.daemon.Audio");
+    ok &= bus.registerService("com.deepin.dde.TrayManager");
+    ok &= bus.registerService("com.deepin.daemon.DiskMount");
+    ok &= bus.registerService("com.deepin.dde.DockMock");
+
+    return ok;
+}
+
+const QStringList MockDaemon::scenarios() const
+{
+    return m_scenarios.keys();
+}
+
+bool MockDaemon::runScenario(const QString &name, const int count, const int interval)
+{
+    if (m_stepTimer->isActive() || !m_scenarios.contains(name) || count <= 0)
+        return false;
+
+    m_scenario = name;
+    m_step = 0;
+    m_count = count;
+
+    m_stepTimer->setInterval(qMax(0, interval));
+    m_stepTimer->start();
+
+    return true;
+}
+
+void MockDaemon::stop()
+{
+    if (!m_stepTimer->isActive())
+        return;
+
+    m_stepTimer->stop();
+
+    emit scenarioFinished(m_scenario, m_step);
+}
+
+///
+/// \brief MockDaemon::setEntryCount grow or shrink the dock entry list to
+/// \a count, tests use it to set up a dock of a known size.
+///
+void MockDaemon::setEntryCount(const int count)
+{
+    for (int i(m_dock->entryCount()); i < count; ++i)
+        m_dock->addEntry(QString("app%1").arg(i));
+    for (int i(m_dock->entryCount()); i > count; --i)
+        m_dock->removeEntry(QString("app%1").arg(i - 1));
+}
+
+void MockDaemon::addEntry(const QString &id, const int index)
+{
+    m_dock->addEntry(id, index);
+}
+
+void MockDaemon::removeEntry(const QString &id)
+{
+    m_dock->removeEntry(id);
+}
+
+int MockDaemon::callCount(const QString &method) const
+{
+    return m_dock->callCount(method);
+}
+
+void MockDaemon::resetCallCounts()
+{
+    m_dock->resetCallCounts();
+}
+
+void MockDaemon::step()
+{
+    (this->*m_scenarios[m_scenario])(m_step, m_count);
+
+    if (++m_step == m_count)
+        stop();
+}
+
+///
+/// \brief MockDaemon::entryFloodStep add entries for the first half of the
+/// run, then remove them again in the same order.
+///
+void MockDaemon::entryFloodStep(const int step, const int count)
+{
+    const int half = (count + 1) / 2;
+
+    if (step < half)
+        m_dock->addEntry(QString("flood%1").arg(step));
+    else
+        m_dock->removeEntry(QString("flood%1").arg(step - half));
+}
+
+///
+/// \brief MockDaemon::windowInfoChurnStep keep one entry and rewrite its
+/// window list every step, windows come and go, titles and attention change.
+///
+void MockDaemon::windowInfoChurnStep(const int step, const int count)
+{
+    MockEntryAdaptor *entry = m_dock->addEntry("churn");
+
+    MockWindowInfoMap infos;
+    const int windows = step % 8 + 1;
+    for (int i(0); i != windows; ++i)
+    {
+        MockWindowInfo info;
+        info.title = QString("churn window %1 - %2").arg(i).arg(step);
+        info.attention = (step + i) % 5 == 0;
+        infos.insert(0x4000000 + i, info);
+    }
+
+    entry->setWindowInfos(infos);
+    entry->setActive(step % 2);
+
+    if (step == count - 1)
+        m_dock->removeEntry("churn");
+}
+
+///
+/// \brief MockDaemon::apScanStormStep emulate a busy scan, 24 access points
+/// appear, change strength and disappear in quick succession.
+///
+void MockDaemon::apScanStormStep(const int step, const int count)
+{
+    Q_UNUSED(count);
+
+    const QString ssid = QString("mock-ap-%1").arg(step % 24);
+    const int strength = (step * 7) % 100;
+
+    if (!m_network->hasAccessPoint(ssid))
+        m_network->addAccessPoint(ssid, strength);
+    else if (step % 4 == 0)
+        m_network->removeAccessPoint(ssid);
+    else
+        m_network->updateAccessPoint(ssid, strength);
+}
+
+void MockDaemon::sinkInputStormStep(const int step, const int count)
+{
+    if (step < (count + 1) / 2)
+        m_audio->addSinkInput();
+    else
+        m_audio->removeSinkInput();
+}
+
+///
+/// \brief MockDaemon::trayFlappingStep add and remove the same few tray
+/// icons over and over, like applications that keep restarting.
+///
+void MockDaemon::trayFlappingStep(const int step, const int count)
+{
+    Q_UNUSED(count);
+
+    const uint winId = 0x5000000 + (step / 2) % 8;
+
+    if (step % 2)
+        m_trayManager->removeIcon(winId);
+    else
+        m_trayManager->addIcon(winId);
+}
+
+void MockDaemon::diskHotplugStep(const int step, const int count)
+{
+    Q_UNUSED(count);
+
+    if (step % 2)
+        m_diskMount->unplugDisk();
+    else
+        m_diskMount->plugDisk(step / 2);
+}
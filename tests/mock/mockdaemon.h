@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MOCKDAEMON_H
+#define MOCKDAEMON_H
+
+#include <QObject>
+#include <QMap>
+
+class QTimer;
+class MockDockAdaptor;
+class MockDisplayAdaptor;
+class MockNetworkAdaptor;
+class MockAudioAdaptor;
+class MockTrayManagerAdaptor;
+class MockDiskMountAdaptor;
+
+///
+/// \brief The MockDaemon class owns the stand-in session services the dock
+/// talks to and replays load scenarios against them. One scenario runs at
+/// a time, a step is taken every interval and ScenarioFinished follows the
+/// last step.
+///
+class MockDaemon : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit MockDaemon(QObject *parent = nullptr);
+
+    bool registerServices();
+
+    const QStringList scenarios() const;
+    bool runScenario(const QString &name, const int count, const int interval);
+    void stop();
+
+    void setEntryCount(const int count);
+    void addEntry(const QString &id, const int index);
+    void removeEntry(const QString &id);
+    int callCount(const QString &method) const;
+    void resetCallCounts();
+
+signals:
+    void scenarioFinished(const QString &name, const int events) const;
+
+private slots:
+    void step();
+
+private:
+    typedef void (MockDaemon::*ScenarioStep)(const int step, const int count);
+
+    void entryFloodStep(const int step, const int count);
+    void windowInfoChurnStep(const int step, const int count);
+    void apScanStormStep(const int step, const int count);
+    void sinkInputStormStep(const int step, const int count);
+    void trayFlappingStep(const int step, const int count);
+    void diskHotplugStep(const int step, const int count);
+
+private:
+    MockDockAdaptor *m_dock;
+    MockDisplayAdaptor *m_display;
+    MockNetworkAdaptor *m_network;
+    MockAudioAdaptor *m_audio;
+    MockTrayManagerAdaptor *m_trayManager;
+    MockDiskMountAdaptor *m_diskMount;
+
+    QTimer *m_stepTimer;
+    QMap<QString, ScenarioStep> m_scenarios;
+    QString m_scenario;
+    int m_step;
+    int m_count;
+};
+
+#endif // MOCKDAEMON_H
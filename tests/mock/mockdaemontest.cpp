@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QtTest>
+#include <QDBusConnection>
+#include <QDBusConnectionInterface>
+#include <QDBusMessage>
+#include <QDBusObjectPath>
+#include <QDBusArgument>
+#include <QProcess>
+
+#define MOCK_SERVICE    "com.deepin.dde.DockMock"
+#define MOCK_PATH       "/com/deepin/dde/DockMock"
+#define MOCK_INTERFACE  "com.deepin.dde.DockMock"
+#define DOCK_SERVICE    "com.deepin.dde.daemon.Dock"
+#define DOCK_PATH       "/com/deepin/dde/daemon/Dock"
+#define DOCK_INTERFACE  "com.deepin.dde.daemon.Dock"
+
+///
+/// \brief The MockDaemonTest class runs dde-dock-mock-daemon out of process,
+/// the same way the dock sees it, and checks the scripted services answer
+/// and signal like the real daemons.
+///
+class MockDaemonTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void entries();
+    void callCount();
+    void propertiesChanged();
+    void scenario_data();
+    void scenario();
+
+    void onScenarioFinished(const QString &name, int events);
+    void onPropertiesChanged(const QString &interface, const QVariantMap &changed, const QStringList &invalidated);
+
+private:
+    const QDBusMessage call(const QString &service, const QString &path, const QString &interface,
+                            const QString &method, const QVariantList &args = QVariantList()) const;
+    const QVariant property(const QString &path, const QString &interface, const QString &name) const;
+
+private:
+    QProcess m_daemon;
+    QString m_finishedScenario;
+    int m_finishedEvents = 0;
+    int m_notifiedEntryCount = 0;
+};
+
+void MockDaemonTest::initTestCase()
+{
+    QDBusConnection bus = QDBusConnection::sessionBus();
+    if (!bus.isConnected())
+        QSKIP("session bus is not available, run the test under dbus-run-session");
+
+    m_daemon.start(MOCK_DAEMON_PATH, QStringList());
+    QVERIFY(m_daemon.waitForStarted());
+    QTRY_VERIFY(bus.interface()->isServiceRegistered(MOCK_SERVICE));
+
+    bus.connect(MOCK_SERVICE, MOCK_PATH, MOCK_INTERFACE, "ScenarioFinished",
+                this, SLOT(onScenarioFinished(QString,int)));
+    bus.connect(DOCK_SERVICE, DOCK_PATH, "org.freedesktop.DBus.Properties", "PropertiesChanged",
+                this, SLOT(onPropertiesChanged(QString,QVariantMap,QStringList)));
+}
+
+void MockDaemonTest::cleanupTestCase()
+{
+    m_daemon.kill();
+    m_daemon.waitForFinished();
+}
+
+void MockDaemonTest::entries()
+{
+    call(MOCK_SERVICE, MOCK_PATH, MOCK_INTERFACE, "SetEntryCount", QVariantList() << 5);
+
+    QList<QDBusObjectPath> paths;
+    qvariant_cast<QDBusArgument>(property(DOCK_PATH, DOCK_INTERFACE, "Entries")) >> paths;
+    QCOMPARE(paths.size(), 5);
+
+    const QVariant id = property(paths.first().path(), "com.deepin.dde.daemon.Dock.Entry", "Id");
+    QCOMPARE(id.toString(), QString("app0"));
+
+    const QDBusMessage reply = call(DOCK_SERVICE, DOCK_PATH, DOCK_INTERFACE, "GetEntryIDs");
+    QCOMPARE(reply.arguments().value(0).toStringList().size(), 5);
+}
+
+void MockDaemonTest::callCount()
+{
+    call(MOCK_SERVICE, MOCK_PATH, MOCK_INTERFACE, "SetEntryCount", QVariantList() << 5);
+    call(MOCK_SERVICE, MOCK_PATH, MOCK_INTERFACE, "ResetCallCounts");
+
+    call(DOCK_SERVICE, DOCK_PATH, DOCK_INTERFACE, "MoveEntry", QVariantList() << 0 << 3);
+
+    const QDBusMessage reply = call(MOCK_SERVICE, MOCK_PATH, MOCK_INTERFACE, "CallCount", QVariantList() << "MoveEntry");
+    QCOMPARE(reply.arguments().value(0).toInt(), 1);
+
+    const QDBusMessage ids = call(DOCK_SERVICE, DOCK_PATH, DOCK_INTERFACE, "GetEntryIDs");
+    QCOMPARE(ids.arguments().value(0).toStringList().at(3), QString("app0"));
+}
+
+void MockDaemonTest::propertiesChanged()
+{
+    call(MOCK_SERVICE, MOCK_PATH, MOCK_INTERFACE, "SetEntryCount", QVariantList() << 8);
+
+    QTRY_COMPARE(m_notifiedEntryCount, 8);
+}
+
+void MockDaemonTest::scenario_data()
+{
+    QTest::addColumn<QString>("name");
+
+    QTest::newRow("entry flood") << "entry-flood";
+    QTest::newRow("window info churn") << "window-info-churn";
+    QTest::newRow("ap scan storm") << "ap-scan-storm";
+    QTest::newRow("sink input storm") << "sink-input-storm";
+    QTest::newRow("tray flapping") << "tray-flapping";
+    QTest::newRow("disk hotplug") << "disk-hotplug";
+}
+
+void MockDaemonTest::scenario()
+{
+    QFETCH(QString, name);
+
+    const QDBusMessage scenarios = call(MOCK_SERVICE, MOCK_PATH, MOCK_INTERFACE, "ListScenarios");
+    QVERIFY(scenarios.arguments().value(0).toStringList().contains(name));
+
+    m_finishedScenario.clear();
+    m_finishedEvents = 0;
+
+    const QDBusMessage reply = call(MOCK_SERVICE, MOCK_PATH, MOCK_INTERFACE, "RunScenario", QVariantList() << name << 40 << 0);
+    QVERIFY(reply.arguments().value(0).toBool());
+
+    QTRY_COMPARE(m_finishedScenario, name);
+    QCOMPARE(m_finishedEvents, 40);
+}
+
+void MockDaemonTest::onScenarioFinished(const QString &name, int events)
+{
+    m_finishedScenario = name;
+    m_finishedEvents = events;
+}
+
+void MockDaemonTest::onPropertiesChanged(const QString &interface, const QVariantMap &changed, const QStringList &invalidated)
+{
+    Q_UNUSED(invalidated);
+
+    if (interface != DOCK_INTERFACE || !changed.contains("Entries"))
+        return;
+
+    QList<QDBusObjectPath> paths;
+    qvariant_cast<QDBusArgument>(changed["Entries"]) >> paths;
+    m_notifiedEntryCount = paths.size();
+}
+
+const QDBusMessage MockDaemonTest::call(const QString &service, const QString &path, const QString &interface,
+                                        const QString &method, const QVariantList &args) const
+{
+    QDBusMessage msg = QDBusMessage::createMethodCall(service, path, interface, method);
+    msg.setArguments(args);
+
+    return QDBusConnection::sessionBus().call(msg);
+}
+
+const QVariant MockDaemonTest::property(const QString &path, const QString &interface, const QString &name) const
+{
+    const QDBusMessage reply = call(DOCK_SERVICE, path, "org.freedesktop.DBus.Properties", "Get",
+                                    QVariantList() << interface << name);
+
+    return qvariant_cast<QDBusVariant>(reply.arguments().value(0)).variant();
+}
+
+QTEST_GUILESS_MAIN(MockDaemonTest)
+
+#include "mockdaemontest.moc"
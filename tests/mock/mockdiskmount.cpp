@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mockdiskmount.h"
+#include "mocktypes.h"
+
+// event codes carried by Changed, the dock itself reacts to DiskList
+#define DISK_EVENT_ADDED    1
+#define DISK_EVENT_REMOVED  2
+
+MockDiskMountAdaptor::MockDiskMountAdaptor(QObject *parent)
+    : QDBusAbstractAdaptor(parent)
+{
+}
+
+void MockDiskMountAdaptor::plugDisk(const int index)
+{
+    MockDiskInfo info;
+    info.id = QString("/org/freedesktop/UDisks2/block_devices/sdx%1").arg(index);
+    info.name = QString("Mock Disk %1").arg(index);
+    info.type = "removable";
+    info.path = QString("/dev/sdx%1").arg(index);
+    info.mountPoint = QString("/media/mock/disk%1").arg(index);
+    info.icon = "drive-removable-media";
+    info.unmountable = true;
+    info.ejectable = true;
+    info.usedSize = 1024 * 1024;
+    info.totalSize = 16 * 1024 * 1024;
+
+    m_disks.append(info);
+
+    emit Changed(DISK_EVENT_ADDED, info.id);
+    notifyDiskList();
+}
+
+void MockDiskMountAdaptor::unplugDisk()
+{
+    if (m_disks.isEmpty())
+        return;
+
+    const MockDiskInfo info = m_disks.takeFirst();
+
+    emit Changed(DISK_EVENT_REMOVED, info.id);
+    notifyDiskList();
+}
+
+void MockDiskMountAdaptor::Eject(const QString &id)
+{
+    for (int i(0); i != m_disks.size(); ++i)
+    {
+        if (m_disks[i].id != id)
+            continue;
+
+        m_disks.removeAt(i);
+        emit Changed(DISK_EVENT_REMOVED, id);
+        notifyDiskList();
+        return;
+    }
+}
+
+MockDiskInfoList MockDiskMountAdaptor::ListDisk()
+{
+    return m_disks;
+}
+
+void MockDiskMountAdaptor::Mount(const QString &id)
+{
+    Q_UNUSED(id);
+}
+
+MockDiskInfo MockDiskMountAdaptor::QueryDisk(const QString &id)
+{
+    for (const auto &info : m_disks)
+        if (info.id == id)
+            return info;
+
+    return MockDiskInfo();
+}
+
+void MockDiskMountAdaptor::Unmount(const QString &id)
+{
+    Eject(id);
+}
+
+void MockDiskMountAdaptor::notifyDiskList()
+{
+    QVariantMap changed;
+    changed["DiskList"] = QVariant::fromValue(m_disks);
+    notifyPropertiesChanged("/com/deepin/daemon/DiskMount", "com.deepin.daemon.DiskMount", changed);
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MOCKDISKMOUNT_H
+#define MOCKDISKMOUNT_H
+
+#include "mocktypes.h"
+
+#include <QDBusAbstractAdaptor>
+
+///
+/// \brief The MockDiskMountAdaptor class stands in for com.deepin.daemon.DiskMount,
+/// the scenarios plug and unplug removable disks.
+///
+class MockDiskMountAdaptor : public QDBusAbstractAdaptor
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "com.deepin.daemon.DiskMount")
+    Q_PROPERTY(MockDiskInfoList DiskList READ diskList)
+
+public:
+    explicit MockDiskMountAdaptor(QObject *parent);
+
+    inline MockDiskInfoList diskList() const { return m_disks; }
+    inline int diskCount() const { return m_disks.size(); }
+
+    void plugDisk(const int index);
+    void unplugDisk();
+
+public slots:
+    void Eject(const QString &id);
+    MockDiskInfoList ListDisk();
+    void Mount(const QString &id);
+    MockDiskInfo QueryDisk(const QString &id);
+    void Unmount(const QString &id);
+
+signals:
+    void Changed(int event, const QString &id);
+    void Error(const QString &id, const QString &message);
+
+private:
+    void notifyDiskList();
+
+private:
+    MockDiskInfoList m_disks;
+};
+
+#endif // MOCKDISKMOUNT_H
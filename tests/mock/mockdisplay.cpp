@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mockdisplay.h"
+
+MockDisplayAdaptor::MockDisplayAdaptor(QObject *parent)
+    : QDBusAbstractAdaptor(parent)
+{
+    m_primaryRect.width = 1920;
+    m_primaryRect.height = 1080;
+}
+
+void MockDisplayAdaptor::setPrimaryRect(const MockRect &rect)
+{
+    m_primaryRect = rect;
+
+    QVariantMap changed;
+    changed["PrimaryRect"] = QVariant::fromValue(m_primaryRect);
+    changed["ScreenWidth"] = QVariant::fromValue(m_primaryRect.width);
+    changed["ScreenHeight"] = QVariant::fromValue(m_primaryRect.height);
+    notifyPropertiesChanged("/com/deepin/daemon/Display", "com.deepin.daemon.Display", changed);
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MOCKDISPLAY_H
+#define MOCKDISPLAY_H
+
+#include "mocktypes.h"
+
+#include <QDBusAbstractAdaptor>
+#include <QDBusObjectPath>
+
+///
+/// \brief The MockDisplayAdaptor class stands in for com.deepin.daemon.Display
+/// with a single output, enough for the dock to place itself.
+///
+class MockDisplayAdaptor : public QDBusAbstractAdaptor
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "com.deepin.daemon.Display")
+    Q_PROPERTY(MockRect PrimaryRect READ primaryRect)
+    Q_PROPERTY(ushort ScreenWidth READ screenWidth)
+    Q_PROPERTY(ushort ScreenHeight READ screenHeight)
+    Q_PROPERTY(QString Primary READ primary)
+    Q_PROPERTY(short DisplayMode READ displayMode)
+    Q_PROPERTY(bool HasChanged READ hasChanged)
+    Q_PROPERTY(QDBusObjectPath BuiltinOutput READ builtinOutput)
+    Q_PROPERTY(QList<QDBusObjectPath> Monitors READ monitors)
+
+public:
+    explicit MockDisplayAdaptor(QObject *parent);
+
+    inline MockRect primaryRect() const { return m_primaryRect; }
+    inline ushort screenWidth() const { return m_primaryRect.width; }
+    inline ushort screenHeight() const { return m_primaryRect.height; }
+    inline QString primary() const { return QStringLiteral("mock-0"); }
+    inline short displayMode() const { return 0; }
+    inline bool hasChanged() const { return false; }
+    inline QDBusObjectPath builtinOutput() const { return QDBusObjectPath("/"); }
+    inline QList<QDBusObjectPath> monitors() const { return QList<QDBusObjectPath>(); }
+
+    void setPrimaryRect(const MockRect &rect);
+
+private:
+    MockRect m_primaryRect;
+};
+
+#endif // MOCKDISPLAY_H
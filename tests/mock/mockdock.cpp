@@ -0,0 +1,285 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mockdock.h"
+
+#include <QDBusConnection>
+
+#define DOCK_PATH       "/com/deepin/dde/daemon/Dock"
+#define DOCK_INTERFACE  "com.deepin.dde.daemon.Dock"
+#define ENTRY_INTERFACE "com.deepin.dde.daemon.Dock.Entry"
+
+MockEntryAdaptor::MockEntryAdaptor(const QString &id, QObject *parent)
+    : QDBusAbstractAdaptor(parent),
+
+      m_id(id),
+      m_path(QString(DOCK_PATH "/entries/%1").arg(id)),
+      m_active(false)
+{
+}
+
+QString MockEntryAdaptor::menu() const
+{
+    return QStringLiteral("{\"checkableMenu\":false,\"singleCheck\":false,\"items\":["
+                          "{\"itemId\":\"open\",\"itemText\":\"Open\",\"isActive\":true,\"isCheckable\":false,"
+                          "\"checked\":false,\"itemIcon\":\"\",\"itemIconHover\":\"\",\"itemIconInactive\":\"\","
+                          "\"showCheckMark\":false,\"itemSubMenu\":null}]}");
+}
+
+uint MockEntryAdaptor::currentWindow() const
+{
+    return m_windowInfos.isEmpty() ? 0 : m_windowInfos.firstKey();
+}
+
+void MockEntryAdaptor::setActive(const bool active)
+{
+    if (m_active == active)
+        return;
+
+    m_active = active;
+
+    QVariantMap changed;
+    changed["IsActive"] = m_active;
+    notifyPropertiesChanged(m_path, ENTRY_INTERFACE, changed);
+}
+
+void MockEntryAdaptor::setWindowInfos(const MockWindowInfoMap &infos)
+{
+    m_windowInfos = infos;
+
+    QVariantMap changed;
+    changed["WindowInfos"] = QVariant::fromValue(m_windowInfos);
+    changed["CurrentWindow"] = currentWindow();
+    notifyPropertiesChanged(m_path, ENTRY_INTERFACE, changed);
+}
+
+void MockEntryAdaptor::Activate(uint timestamp)
+{
+    Q_UNUSED(timestamp);
+
+    setActive(!m_active);
+}
+
+void MockEntryAdaptor::HandleDragDrop(uint timestamp, const QStringList &files)
+{
+    Q_UNUSED(timestamp);
+    Q_UNUSED(files);
+}
+
+void MockEntryAdaptor::HandleMenuItem(uint timestamp, const QString &id)
+{
+    Q_UNUSED(timestamp);
+    Q_UNUSED(id);
+}
+
+void MockEntryAdaptor::NewInstance(uint timestamp)
+{
+    Q_UNUSED(timestamp);
+}
+
+void MockEntryAdaptor::PresentWindows()
+{
+}
+
+void MockEntryAdaptor::RequestUndock()
+{
+}
+
+MockDockAdaptor::MockDockAdaptor(QObject *parent)
+    : QDBusAbstractAdaptor(parent),
+
+      m_displayMode(1),
+      m_hideMode(0),
+      m_position(2)
+{
+}
+
+QList<QDBusObjectPath> MockDockAdaptor::entries() const
+{
+    QList<QDBusObjectPath> paths;
+    for (auto *entry : m_entries)
+        paths << QDBusObjectPath(entry->path());
+
+    return paths;
+}
+
+void MockDockAdaptor::setDisplayMode(const int mode)
+{
+    m_displayMode = mode;
+    notify("DisplayMode", mode);
+}
+
+void MockDockAdaptor::setHideMode(const int mode)
+{
+    m_hideMode = mode;
+    notify("HideMode", mode);
+}
+
+void MockDockAdaptor::setPosition(const int position)
+{
+    m_position = position;
+    notify("Position", position);
+}
+
+MockEntryAdaptor *MockDockAdaptor::addEntry(const QString &id, const int index)
+{
+    if (MockEntryAdaptor *exist = entry(id))
+        return exist;
+
+    // every entry lives on its own object, the adaptor is exported through it
+    QObject *object = new QObject(parent());
+    MockEntryAdaptor *adaptor = new MockEntryAdaptor(id, object);
+    QDBusConnection::sessionBus().registerObject(adaptor->path(), object);
+
+    const int position = index < 0 || index > m_entries.size() ? m_entries.size() : index;
+    m_entries.insert(position, adaptor);
+
+    emit EntryAdded(QDBusObjectPath(adaptor->path()), position);
+    notifyEntries();
+
+    return adaptor;
+}
+
+void MockDockAdaptor::removeEntry(const QString &id)
+{
+    MockEntryAdaptor *adaptor = entry(id);
+    if (!adaptor)
+        return;
+
+    m_entries.removeOne(adaptor);
+    QDBusConnection::sessionBus().unregisterObject(adaptor->path());
+    adaptor->parent()->deleteLater();
+
+    emit EntryRemoved(id);
+    notifyEntries();
+}
+
+MockEntryAdaptor *MockDockAdaptor::entry(const QString &id) const
+{
+    for (auto *entry : m_entries)
+        if (entry->id() == id)
+            return entry;
+
+    return nullptr;
+}
+
+void MockDockAdaptor::ActivateWindow(uint win)
+{
+    Q_UNUSED(win);
+
+    ++m_calls["ActivateWindow"];
+}
+
+void MockDockAdaptor::CloseWindow(uint win)
+{
+    Q_UNUSED(win);
+
+    ++m_calls["CloseWindow"];
+}
+
+void MockDockAdaptor::PreviewWindow(uint win)
+{
+    Q_UNUSED(win);
+
+    ++m_calls["PreviewWindow"];
+}
+
+void MockDockAdaptor::CancelPreviewWindow()
+{
+    ++m_calls["CancelPreviewWindow"];
+}
+
+QStringList MockDockAdaptor::GetEntryIDs()
+{
+    ++m_calls["GetEntryIDs"];
+
+    QStringList ids;
+    for (auto *entry : m_entries)
+        ids << entry->id();
+
+    return ids;
+}
+
+void MockDockAdaptor::MoveEntry(int index, int newIndex)
+{
+    ++m_calls["MoveEntry"];
+
+    if (index < 0 || index >= m_entries.size() || newIndex < 0 || newIndex >= m_entries.size())
+        return;
+
+    m_entries.move(index, newIndex);
+    notifyEntries();
+}
+
+bool MockDockAdaptor::RequestDock(const QString &desktopFile, int index)
+{
+    Q_UNUSED(desktopFile);
+    Q_UNUSED(index);
+
+    ++m_calls["RequestDock"];
+    return false;
+}
+
+bool MockDockAdaptor::IsDocked(const QString &desktopFile)
+{
+    Q_UNUSED(desktopFile);
+
+    ++m_calls["IsDocked"];
+    return false;
+}
+
+bool MockDockAdaptor::IsOnDock(const QString &desktopFile)
+{
+    Q_UNUSED(desktopFile);
+
+    ++m_calls["IsOnDock"];
+    return false;
+}
+
+bool MockDockAdaptor::RequestUndock(const QString &desktopFile)
+{
+    Q_UNUSED(desktopFile);
+
+    ++m_calls["RequestUndock"];
+    return false;
+}
+
+void MockDockAdaptor::SetFrontendWindowRect(int x, int y, uint width, uint height)
+{
+    Q_UNUSED(x);
+    Q_UNUSED(y);
+    Q_UNUSED(width);
+    Q_UNUSED(height);
+
+    ++m_calls["SetFrontendWindowRect"];
+}
+
+void MockDockAdaptor::notifyEntries()
+{
+    notify("Entries", QVariant::fromValue(entries()));
+}
+
+void MockDockAdaptor::notify(const QString &name, const QVariant &value)
+{
+    QVariantMap changed;
+    changed[name] = value;
+    notifyPropertiesChanged(DOCK_PATH, DOCK_INTERFACE, changed);
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MOCKDOCK_H
+#define MOCKDOCK_H
+
+#include "mocktypes.h"
+
+#include <QDBusAbstractAdaptor>
+#include <QDBusObjectPath>
+#include <QStringList>
+#include <QMap>
+
+///
+/// \brief The MockEntryAdaptor class stands in for one dock daemon entry,
+/// com.deepin.dde.daemon.Dock.Entry, the scenarios drive its windows.
+///
+class MockEntryAdaptor : public QDBusAbstractAdaptor
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "com.deepin.dde.daemon.Dock.Entry")
+    Q_PROPERTY(QString Id READ id)
+    Q_PROPERTY(QString Name READ name)
+    Q_PROPERTY(QString Icon READ icon)
+    Q_PROPERTY(QString Menu READ menu)
+    Q_PROPERTY(bool IsActive READ isActive)
+    Q_PROPERTY(bool IsDocked READ isDocked)
+    Q_PROPERTY(uint CurrentWindow READ currentWindow)
+    Q_PROPERTY(MockWindowInfoMap WindowInfos READ windowInfos)
+
+public:
+    explicit MockEntryAdaptor(const QString &id, QObject *parent);
+
+    inline const QString path() const { return m_path; }
+    inline QString id() const { return m_id; }
+    inline QString name() const { return m_id; }
+    inline QString icon() const { return QStringLiteral("application-x-executable"); }
+    QString menu() const;
+    inline bool isActive() const { return m_active; }
+    inline bool isDocked() const { return false; }
+    uint currentWindow() const;
+    inline MockWindowInfoMap windowInfos() const { return m_windowInfos; }
+
+    void setActive(const bool active);
+    void setWindowInfos(const MockWindowInfoMap &infos);
+
+public slots:
+    void Activate(uint timestamp);
+    void HandleDragDrop(uint timestamp, const QStringList &files);
+    void HandleMenuItem(uint timestamp, const QString &id);
+    void NewInstance(uint timestamp);
+    void PresentWindows();
+    void RequestUndock();
+
+private:
+    const QString m_id;
+    const QString m_path;
+    bool m_active;
+    MockWindowInfoMap m_windowInfos;
+};
+
+///
+/// \brief The MockDockAdaptor class stands in for com.deepin.dde.daemon.Dock,
+/// it owns the entries and counts the calls the dock makes on it.
+///
+class MockDockAdaptor : public QDBusAbstractAdaptor
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "com.deepin.dde.daemon.Dock")
+    Q_PROPERTY(QList<QDBusObjectPath> Entries READ entries)
+    Q_PROPERTY(int DisplayMode READ displayMode WRITE setDisplayMode)
+    Q_PROPERTY(int HideMode READ hideMode WRITE setHideMode)
+    Q_PROPERTY(int HideState READ hideState)
+    Q_PROPERTY(int Position READ position WRITE setPosition)
+    Q_PROPERTY(uint IconSize READ iconSize)
+    Q_PROPERTY(uint ActiveWindow READ activeWindow)
+    Q_PROPERTY(uint ShowTimeout READ showTimeout)
+
+public:
+    explicit MockDockAdaptor(QObject *parent);
+
+    QList<QDBusObjectPath> entries() const;
+    inline int displayMode() const { return m_displayMode; }
+    inline int hideMode() const { return m_hideMode; }
+    inline int hideState() const { return 1; }
+    inline int position() const { return m_position; }
+    inline uint iconSize() const { return 36; }
+    inline uint activeWindow() const { return 0; }
+    inline uint showTimeout() const { return 100; }
+
+    void setDisplayMode(const int mode);
+    void setHideMode(const int mode);
+    void setPosition(const int position);
+
+    MockEntryAdaptor *addEntry(const QString &id, const int index = -1);
+    void removeEntry(const QString &id);
+    MockEntryAdaptor *entry(const QString &id) const;
+    inline int entryCount() const { return m_entries.size(); }
+    inline int callCount(const QString &method) const { return m_calls.value(method); }
+    inline void resetCallCounts() { m_calls.clear(); }
+
+public slots:
+    void ActivateWindow(uint win);
+    void CloseWindow(uint win);
+    void PreviewWindow(uint win);
+    void CancelPreviewWindow();
+    QStringList GetEntryIDs();
+    void MoveEntry(int index, int newIndex);
+    bool RequestDock(const QString &desktopFile, int index);
+    bool IsDocked(const QString &desktopFile);
+    bool IsOnDock(const QString &desktopFile);
+    bool RequestUndock(const QString &desktopFile);
+    void SetFrontendWindowRect(int x, int y, uint width, uint height);
+
+signals:
+    void EntryAdded(const QDBusObjectPath &path, int index);
+    void EntryRemoved(const QString &id);
+
+private:
+    void notifyEntries();
+    void notify(const QString &name, const QVariant &value);
+
+private:
+    int m_displayMode;
+    int m_hideMode;
+    int m_position;
+    QList<MockEntryAdaptor *> m_entries;
+    QMap<QString, int> m_calls;
+};
+
+#endif // MOCKDOCK_H
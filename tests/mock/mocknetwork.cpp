@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mocknetwork.h"
+
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QHash>
+
+MockNetworkAdaptor::MockNetworkAdaptor(QObject *parent)
+    : QDBusAbstractAdaptor(parent)
+{
+}
+
+const QString MockNetworkAdaptor::wirelessDevicePath()
+{
+    return QStringLiteral("/org/freedesktop/NetworkManager/Devices/2");
+}
+
+QString MockNetworkAdaptor::devices() const
+{
+    QJsonObject wired;
+    wired["Path"] = "/org/freedesktop/NetworkManager/Devices/1";
+    wired["HwAddress"] = "00:16:3e:00:00:01";
+    wired["State"] = 100;
+    wired["Vendor"] = "mock";
+
+    QJsonObject wireless;
+    wireless["Path"] = wirelessDevicePath();
+    wireless["HwAddress"] = "00:16:3e:00:00:02";
+    wireless["State"] = 30;
+    wireless["Vendor"] = "mock";
+    wireless["ActiveAp"] = "/";
+
+    QJsonObject devices;
+    devices["wired"] = QJsonArray() << wired;
+    devices["wireless"] = QJsonArray() << wireless;
+
+    return QString::fromUtf8(QJsonDocument(devices).toJson(QJsonDocument::Compact));
+}
+
+void MockNetworkAdaptor::addAccessPoint(const QString &ssid, const int strength)
+{
+    m_accessPoints.insert(ssid, strength);
+
+    emit AccessPointAdded(wirelessDevicePath(), accessPointInfo(ssid));
+}
+
+void MockNetworkAdaptor::updateAccessPoint(const QString &ssid, const int strength)
+{
+    if (!m_accessPoints.contains(ssid))
+        return;
+
+    m_accessPoints[ssid] = strength;
+
+    emit AccessPointPropertiesChanged(wirelessDevicePath(), accessPointInfo(ssid));
+}
+
+void MockNetworkAdaptor::removeAccessPoint(const QString &ssid)
+{
+    if (!m_accessPoints.contains(ssid))
+        return;
+
+    const QString info = accessPointInfo(ssid);
+    m_accessPoints.remove(ssid);
+
+    emit AccessPointRemoved(wirelessDevicePath(), info);
+}
+
+QString MockNetworkAdaptor::GetAccessPoints(const QDBusObjectPath &device)
+{
+    QJsonArray aps;
+    if (device.path() == wirelessDevicePath())
+        for (auto it(m_accessPoints.cbegin()); it != m_accessPoints.cend(); ++it)
+            aps.append(QJsonDocument::fromJson(accessPointInfo(it.key()).toUtf8()).object());
+
+    return QString::fromUtf8(QJsonDocument(aps).toJson(QJsonDocument::Compact));
+}
+
+QString MockNetworkAdaptor::GetActiveConnectionInfo()
+{
+    return QStringLiteral("[]");
+}
+
+bool MockNetworkAdaptor::IsDeviceEnabled(const QDBusObjectPath &device)
+{
+    Q_UNUSED(device);
+
+    return true;
+}
+
+void MockNetworkAdaptor::EnableDevice(const QDBusObjectPath &device, bool enabled)
+{
+    emit DeviceEnabled(device.path(), enabled);
+}
+
+void MockNetworkAdaptor::DisconnectDevice(const QDBusObjectPath &device)
+{
+    Q_UNUSED(device);
+}
+
+QDBusObjectPath MockNetworkAdaptor::ActivateAccessPoint(const QString &uuid, const QDBusObjectPath &ap, const QDBusObjectPath &device)
+{
+    Q_UNUSED(uuid);
+    Q_UNUSED(ap);
+    Q_UNUSED(device);
+
+    return QDBusObjectPath("/");
+}
+
+void MockNetworkAdaptor::FeedSecret(const QString &path, const QString &name, const QString &key, bool autoConnect)
+{
+    Q_UNUSED(path);
+    Q_UNUSED(name);
+    Q_UNUSED(key);
+    Q_UNUSED(autoConnect);
+}
+
+void MockNetworkAdaptor::CancelSecret(const QString &path, const QString &name)
+{
+    Q_UNUSED(path);
+    Q_UNUSED(name);
+}
+
+const QString MockNetworkAdaptor::accessPointInfo(const QString &ssid) const
+{
+    QJsonObject info;
+    info["Ssid"] = ssid;
+    info["Path"] = QString("/org/freedesktop/NetworkManager/AccessPoint/%1").arg(qHash(ssid));
+    info["Strength"] = m_accessPoints.value(ssid);
+    info["Secured"] = true;
+    info["SecuredInEap"] = false;
+
+    return QString::fromUtf8(QJsonDocument(info).toJson(QJsonDocument::Compact));
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MOCKNETWORK_H
+#define MOCKNETWORK_H
+
+#include <QDBusAbstractAdaptor>
+#include <QDBusObjectPath>
+#include <QMap>
+
+///
+/// \brief The MockNetworkAdaptor class stands in for com.deepin.daemon.Network
+/// with one wired and one wireless device, the access points of the wireless
+/// device are driven by the scenarios.
+///
+class MockNetworkAdaptor : public QDBusAbstractAdaptor
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "com.deepin.daemon.Network")
+    Q_PROPERTY(QString Devices READ devices)
+    Q_PROPERTY(QString ActiveConnections READ activeConnections)
+    Q_PROPERTY(QString Connections READ connections)
+    Q_PROPERTY(bool NetworkingEnabled READ networkingEnabled)
+    Q_PROPERTY(bool VpnEnabled READ vpnEnabled)
+    Q_PROPERTY(uint State READ state)
+
+public:
+    explicit MockNetworkAdaptor(QObject *parent);
+
+    static const QString wirelessDevicePath();
+
+    QString devices() const;
+    inline QString activeConnections() const { return QStringLiteral("{}"); }
+    inline QString connections() const { return QStringLiteral("{}"); }
+    inline bool networkingEnabled() const { return true; }
+    inline bool vpnEnabled() const { return false; }
+    inline uint state() const { return 70; }
+
+    inline bool hasAccessPoint(const QString &ssid) const { return m_accessPoints.contains(ssid); }
+    void addAccessPoint(const QString &ssid, const int strength);
+    void updateAccessPoint(const QString &ssid, const int strength);
+    void removeAccessPoint(const QString &ssid);
+
+public slots:
+    QString GetAccessPoints(const QDBusObjectPath &device);
+    QString GetActiveConnectionInfo();
+    bool IsDeviceEnabled(const QDBusObjectPath &device);
+    void EnableDevice(const QDBusObjectPath &device, bool enabled);
+    void DisconnectDevice(const QDBusObjectPath &device);
+    QDBusObjectPath ActivateAccessPoint(const QString &uuid, const QDBusObjectPath &ap, const QDBusObjectPath &device);
+    void FeedSecret(const QString &path, const QString &name, const QString &key, bool autoConnect);
+    void CancelSecret(const QString &path, const QString &name);
+
+signals:
+    void AccessPointAdded(const QString &devPath, const QString &info);
+    void AccessPointPropertiesChanged(const QString &devPath, const QString &info);
+    void AccessPointRemoved(const QString &devPath, const QString &info);
+    void DeviceEnabled(const QString &devPath, bool enabled);
+
+private:
+    const QString accessPointInfo(const QString &ssid) const;
+
+private:
+    QMap<QString, int> m_accessPoints;
+};
+
+#endif // MOCKNETWORK_H
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mocktraymanager.h"
+#include "mocktypes.h"
+
+MockTrayManagerAdaptor::MockTrayManagerAdaptor(QObject *parent)
+    : QDBusAbstractAdaptor(parent)
+{
+}
+
+void MockTrayManagerAdaptor::addIcon(const uint winId)
+{
+    if (m_trayIcons.contains(winId))
+        return;
+
+    m_trayIcons.append(winId);
+
+    emit Added(winId);
+    notifyTrayIcons();
+}
+
+void MockTrayManagerAdaptor::removeIcon(const uint winId)
+{
+    if (!m_trayIcons.removeOne(winId))
+        return;
+
+    emit Removed(winId);
+    notifyTrayIcons();
+}
+
+void MockTrayManagerAdaptor::EnableNotification(uint winId, bool enabled)
+{
+    Q_UNUSED(winId);
+    Q_UNUSED(enabled);
+}
+
+QString MockTrayManagerAdaptor::GetName(uint winId)
+{
+    return QString("mock-tray-%1").arg(winId);
+}
+
+bool MockTrayManagerAdaptor::Manage()
+{
+    emit Inited();
+
+    return true;
+}
+
+void MockTrayManagerAdaptor::RetryManager()
+{
+}
+
+bool MockTrayManagerAdaptor::Unmanage()
+{
+    return true;
+}
+
+void MockTrayManagerAdaptor::notifyTrayIcons()
+{
+    QVariantMap changed;
+    changed["TrayIcons"] = QVariant::fromValue(m_trayIcons);
+    notifyPropertiesChanged("/com/deepin/dde/TrayManager", "com.deepin.dde.TrayManager", changed);
+}
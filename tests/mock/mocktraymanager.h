@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MOCKTRAYMANAGER_H
+#define MOCKTRAYMANAGER_H
+
+#include <QDBusAbstractAdaptor>
+#include <QList>
+
+///
+/// \brief The MockTrayManagerAdaptor class stands in for com.deepin.dde.TrayManager.
+/// The icons are plain ids without a real client window, the dock drops
+/// them once embedding fails, which is the flapping path we want to load.
+///
+class MockTrayManagerAdaptor : public QDBusAbstractAdaptor
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "com.deepin.dde.TrayManager")
+    Q_PROPERTY(QList<uint> TrayIcons READ trayIcons)
+
+public:
+    explicit MockTrayManagerAdaptor(QObject *parent);
+
+    inline QList<uint> trayIcons() const { return m_trayIcons; }
+
+    void addIcon(const uint winId);
+    void removeIcon(const uint winId);
+
+public slots:
+    void EnableNotification(uint winId, bool enabled);
+    QString GetName(uint winId);
+    bool Manage();
+    void RetryManager();
+    bool Unmanage();
+
+signals:
+    void Added(uint winId);
+    void Changed(uint winId);
+    void Inited();
+    void Removed(uint winId);
+
+private:
+    void notifyTrayIcons();
+
+private:
+    QList<uint> m_trayIcons;
+};
+
+#endif // MOCKTRAYMANAGER_H
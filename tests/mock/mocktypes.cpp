@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mocktypes.h"
+
+#include <QDBusConnection>
+#include <QDBusMessage>
+#include <QDBusMetaType>
+#include <QStringList>
+
+QDBusArgument &operator<<(QDBusArgument &argument, const MockRect &rect)
+{
+    argument.beginStructure();
+    argument << rect.x << rect.y << rect.width << rect.height;
+    argument.endStructure();
+    return argument;
+}
+
+const QDBusArgument &operator>>(const QDBusArgument &argument, MockRect &rect)
+{
+    argument.beginStructure();
+    argument >> rect.x >> rect.y >> rect.width >> rect.height;
+    argument.endStructure();
+    return argument;
+}
+
+QDBusArgument &operator<<(QDBusArgument &argument, const MockWindowInfo &info)
+{
+    argument.beginStructure();
+    argument << info.title << info.attention;
+    argument.endStructure();
+    return argument;
+}
+
+const QDBusArgument &operator>>(const QDBusArgument &argument, MockWindowInfo &info)
+{
+    argument.beginStructure();
+    argument >> info.title >> info.attention;
+    argument.endStructure();
+    return argument;
+}
+
+QDBusArgument &operator<<(QDBusArgument &argument, const MockDiskInfo &info)
+{
+    argument.beginStructure();
+    argument << info.id << info.name << info.type << info.path << info.mountPoint << info.icon;
+    argument << info.unmountable << info.ejectable;
+    argument << info.usedSize << info.totalSize;
+    argument.endStructure();
+    return argument;
+}
+
+const QDBusArgument &operator>>(const QDBusArgument &argument, MockDiskInfo &info)
+{
+    argument.beginStructure();
+    argument >> info.id >> info.name >> info.type >> info.path >> info.mountPoint >> info.icon;
+    argument >> info.unmountable >> info.ejectable;
+    argument >> info.usedSize >> info.totalSize;
+    argument.endStructure();
+    return argument;
+}
+
+void registerMockTypes()
+{
+    qDBusRegisterMetaType<MockRect>();
+    qDBusRegisterMetaType<MockWindowInfo>();
+    qDBusRegisterMetaType<MockWindowInfoMap>();
+    qDBusRegisterMetaType<MockDiskInfo>();
+    qDBusRegisterMetaType<MockDiskInfoList>();
+}
+
+void notifyPropertiesChanged(const QString &path, const QString &interface, const QVariantMap &changed)
+{
+    QDBusMessage msg = QDBusMessage::createSignal(path, "org.freedesktop.DBus.Properties", "PropertiesChanged");
+    msg << interface << changed << QStringList();
+
+    QDBusConnection::sessionBus().send(msg);
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MOCKTYPES_H
+#define MOCKTYPES_H
+
+#include <QString>
+#include <QMap>
+#include <QList>
+#include <QVariantMap>
+#include <QDBusArgument>
+
+///
+/// \brief The MockRect struct matches the (nnqq) rect the display daemon
+/// publishes as PrimaryRect.
+///
+struct MockRect
+{
+    qint16 x = 0;
+    qint16 y = 0;
+    quint16 width = 0;
+    quint16 height = 0;
+};
+
+///
+/// \brief The MockWindowInfo struct matches one (sb) value of the dock
+/// entry WindowInfos map, the window title and its attention flag.
+///
+struct MockWindowInfo
+{
+    QString title;
+    bool attention = false;
+};
+
+typedef QMap<uint, MockWindowInfo> MockWindowInfoMap;
+
+///
+/// \brief The MockDiskInfo struct matches one (ssssssbbtt) entry of the
+/// disk mount daemon DiskList.
+///
+struct MockDiskInfo
+{
+    QString id;
+    QString name;
+    QString type;
+    QString path;
+    QString mountPoint;
+    QString icon;
+    bool unmountable = false;
+    bool ejectable = false;
+    quint64 usedSize = 0;
+    quint64 totalSize = 0;
+};
+
+typedef QList<MockDiskInfo> MockDiskInfoList;
+
+Q_DECLARE_METATYPE(MockRect)
+Q_DECLARE_METATYPE(MockWindowInfo)
+Q_DECLARE_METATYPE(MockWindowInfoMap)
+Q_DECLARE_METATYPE(MockDiskInfo)
+Q_DECLARE_METATYPE(MockDiskInfoList)
+
+QDBusArgument &operator<<(QDBusArgument &argument, const MockRect &rect);
+const QDBusArgument &operator>>(const QDBusArgument &argument, MockRect &rect);
+QDBusArgument &operator<<(QDBusArgument &argument, const MockWindowInfo &info);
+const QDBusArgument &operator>>(const QDBusArgument &argument, MockWindowInfo &info);
+QDBusArgument &operator<<(QDBusArgument &argument, const MockDiskInfo &info);
+const QDBusArgument &operator>>(const QDBusArgument &argument, MockDiskInfo &info);
+
+void registerMockTypes();
+
+///
+/// \brief notifyPropertiesChanged emit org.freedesktop.DBus.Properties.PropertiesChanged
+/// for \a path, adaptors do not send it on their own and the dock only
+/// refreshes its cached properties from this signal.
+///
+void notifyPropertiesChanged(const QString &path, const QString &interface, const QVariantMap &changed);
+
+#endif // MOCKTYPES_H
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2011 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     sbw <sbw@sbw.so>
+ *
+ * Maintainer: sbw <sbw@sbw.so>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "util/iconframecache.h"
+#include "item/wireditem.h"
+#include "item/wirelessitem.h"
+#include "networkmanager.h"
+#include "fakenetwork.h"
+
+#include <QtTest>
+#include <QApplication>
+
+///
+/// \brief The IconFrameCacheTest class checks the network icons are parsed
+/// from svg once per size, however often the animation cycles or the
+/// items resize.
+///
+class IconFrameCacheTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void firstCycleOnly_data();
+    void firstCycleOnly();
+    void resizeKeepsOtherSizes();
+    void connectingItems();
+
+private:
+    void cycle(const int size, const qreal ratio);
+    void cycleItems(QWidget *wireless);
+};
+
+void IconFrameCacheTest::firstCycleOnly_data()
+{
+    QTest::addColumn<int>("size");
+    QTest::addColumn<qreal>("ratio");
+
+    QTest::newRow("efficient") << 16 << qreal(1);
+    QTest::newRow("fashion") << 38 << qreal(1);
+    QTest::newRow("fashion hidpi") << 38 << qreal(2);
+}
+
+void IconFrameCacheTest::firstCycleOnly()
+{
+    QFETCH(int, size);
+    QFETCH(qreal, ratio);
+
+    IconFrameCache *cache = IconFrameCache::instance();
+
+    const int before = cache->rasterizeCount();
+    cycle(size, ratio);
+    QCOMPARE(cache->rasterizeCount(), before + IconFrameCache::FrameCount);
+
+    for (int i(0); i != 10; ++i)
+        cycle(size, ratio);
+    QCOMPARE(cache->rasterizeCount(), before + IconFrameCache::FrameCount);
+}
+
+void IconFrameCacheTest::resizeKeepsOtherSizes()
+{
+    IconFrameCache *cache = IconFrameCache::instance();
+
+    // a resize animation passes through new sizes, going back must not parse again
+    cycle(24, 1);
+    const int settled = cache->rasterizeCount();
+
+    cycle(30, 1);
+    QCOMPARE(cache->rasterizeCount(), settled + IconFrameCache::FrameCount);
+
+    cycle(24, 1);
+    QCOMPARE(cache->rasterizeCount(), settled + IconFrameCache::FrameCount);
+}
+
+///
+/// \brief IconFrameCacheTest::connectingItems animate a wired and a wireless
+/// item the way the plugin does while both connect, only the first cycle may
+/// parse svgs.
+///
+void IconFrameCacheTest::connectingItems()
+{
+    FakeNetwork network;
+    if (!network.registerService())
+        QSKIP("session bus is not available, run the test under dbus-run-session");
+
+    const QString wiredPath = FakeNetwork::devicePath("wired", 0);
+    const QString wirelessPath = FakeNetwork::devicePath("wireless", 0);
+
+    network.setDevices(1, 1, 0, NetworkDevice::Config);
+    network.setActiveConnection("wired", wiredPath);
+    network.setState(NetworkManager::Connecting);
+
+    NetworkManager *manager = NetworkManager::instance();
+    manager->init();
+    QTRY_COMPARE(manager->deviceList().size(), 2);
+    QTRY_VERIFY(manager->activeDeviceSet().contains(wiredPath));
+
+    WiredItem wired(wiredPath);
+    wired.setFixedSize(40, 40);
+    wired.show();
+
+    // the wireless item paints from its applet, which is built queued
+    WirelessItem wireless(wirelessPath);
+    wireless.setFixedSize(40, 40);
+    QTRY_VERIFY(wireless.itemApplet()->layout());
+    wireless.show();
+
+    QVERIFY(QTest::qWaitForWindowExposed(&wired));
+    QVERIFY(QTest::qWaitForWindowExposed(&wireless));
+
+    IconFrameCache *cache = IconFrameCache::instance();
+    QTRY_VERIFY(cache->isAnimating(&wired));
+    QTRY_VERIFY(cache->isAnimating(&wireless));
+
+    const int before = cache->rasterizeCount();
+    cycleItems(&wireless);
+    const int settled = cache->rasterizeCount();
+    QVERIFY(settled > before);
+
+    for (int i(0); i != 10; ++i)
+        cycleItems(&wireless);
+    QCOMPARE(cache->rasterizeCount(), settled);
+}
+
+void IconFrameCacheTest::cycle(const int size, const qreal ratio)
+{
+    IconFrameCache *cache = IconFrameCache::instance();
+
+    for (int i(0); i != IconFrameCache::FrameCount; ++i)
+    {
+        const QString name = QString("network-wired-symbolic-connecting%1").arg(i + 1);
+        const QPixmap pixmap = cache->icon(name, QString(":/wired/resources/wired/%1.svg").arg(name), size * ratio, ratio);
+        QVERIFY(!pixmap.isNull());
+    }
+}
+
+///
+/// \brief IconFrameCacheTest::cycleItems step through every frame, the wired
+/// item loads its frame on the change, the wireless one when it paints.
+///
+void IconFrameCacheTest::cycleItems(QWidget *wireless)
+{
+    IconFrameCache *cache = IconFrameCache::instance();
+
+    for (int i(0); i != IconFrameCache::FrameCount; ++i)
+    {
+        QVERIFY(QMetaObject::invokeMethod(cache, "nextFrame"));
+        wireless->repaint();
+    }
+}
+
+QTEST_MAIN(IconFrameCacheTest)
+
+#include "iconframecachetest.moc"